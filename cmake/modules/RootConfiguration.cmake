@@ -491,6 +491,11 @@ if(veccore)
 else()
   set(hasveccore undef)
 endif()
+if(clad)
+  set(hasclad define)
+else()
+  set(hasclad undef)
+endif()
 if(cxx11)
   set(cxxversion cxx11)
   set(usec++11 define)
@@ -446,6 +446,83 @@ inline void frombuf(char *&buf, Long_t *x)   { frombuf(buf, (ULong_t *) x); }
 inline void frombuf(char *&buf, Long64_t *x) { frombuf(buf, (ULong64_t *) x); }
 
 
+//______________________________________________________________________________
+// Array versions of tobuf() and frombuf(), packing or unpacking n values at
+// once. The byte swapping is done by a plain loop (no asm, no volatile) that
+// the compiler turns into vector byte shuffles.
+
+#ifdef R__BYTESWAP
+#if defined(__GNUC__)
+inline UShort_t  R__bswapelem(UShort_t x)  { return __builtin_bswap16(x); }
+inline UInt_t    R__bswapelem(UInt_t x)    { return __builtin_bswap32(x); }
+inline ULong64_t R__bswapelem(ULong64_t x) { return __builtin_bswap64(x); }
+#else
+inline UShort_t  R__bswapelem(UShort_t x)  { return (UShort_t)((x << 8) | (x >> 8)); }
+inline UInt_t    R__bswapelem(UInt_t x)
+{
+   return ((x & 0x000000ffU) << 24) | ((x & 0x0000ff00U) <<  8) |
+          ((x & 0x00ff0000U) >>  8) | ((x & 0xff000000U) >> 24);
+}
+inline ULong64_t R__bswapelem(ULong64_t x)
+{
+   return ((ULong64_t)R__bswapelem((UInt_t)x) << 32) | R__bswapelem((UInt_t)(x >> 32));
+}
+#endif
+
+// Copy n elements of sizeof(U) bytes from `from` to `to`, swapping each of them.
+template <typename U>
+inline void R__bswapcpy(char *to, const char *from, Int_t n)
+{
+   for (Int_t i = 0; i < n; ++i) {
+      U v;
+      memcpy(&v, from + i * sizeof(U), sizeof(U));
+      v = R__bswapelem(v);
+      memcpy(to + i * sizeof(U), &v, sizeof(U));
+   }
+}
+#endif
+
+template <typename T, typename U>
+inline void R__tobufarray(char *&buf, const T *x, Int_t n)
+{
+#ifdef R__BYTESWAP
+   R__bswapcpy<U>(buf, (const char *)x, n);
+#else
+   memcpy(buf, x, n * sizeof(T));
+#endif
+   buf += n * sizeof(T);
+}
+
+template <typename T, typename U>
+inline void R__frombufarray(char *&buf, T *x, Int_t n)
+{
+#ifdef R__BYTESWAP
+   R__bswapcpy<U>((char *)x, buf, n);
+#else
+   memcpy(x, buf, n * sizeof(T));
+#endif
+   buf += n * sizeof(T);
+}
+
+inline void tobuf(char *&buf, const Short_t *x, Int_t n)    { R__tobufarray<Short_t, UShort_t>(buf, x, n); }
+inline void tobuf(char *&buf, const UShort_t *x, Int_t n)   { R__tobufarray<UShort_t, UShort_t>(buf, x, n); }
+inline void tobuf(char *&buf, const Int_t *x, Int_t n)      { R__tobufarray<Int_t, UInt_t>(buf, x, n); }
+inline void tobuf(char *&buf, const UInt_t *x, Int_t n)     { R__tobufarray<UInt_t, UInt_t>(buf, x, n); }
+inline void tobuf(char *&buf, const Long64_t *x, Int_t n)   { R__tobufarray<Long64_t, ULong64_t>(buf, x, n); }
+inline void tobuf(char *&buf, const ULong64_t *x, Int_t n)  { R__tobufarray<ULong64_t, ULong64_t>(buf, x, n); }
+inline void tobuf(char *&buf, const Float_t *x, Int_t n)    { R__tobufarray<Float_t, UInt_t>(buf, x, n); }
+inline void tobuf(char *&buf, const Double_t *x, Int_t n)   { R__tobufarray<Double_t, ULong64_t>(buf, x, n); }
+
+inline void frombuf(char *&buf, Short_t *x, Int_t n)   { R__frombufarray<Short_t, UShort_t>(buf, x, n); }
+inline void frombuf(char *&buf, UShort_t *x, Int_t n)  { R__frombufarray<UShort_t, UShort_t>(buf, x, n); }
+inline void frombuf(char *&buf, Int_t *x, Int_t n)     { R__frombufarray<Int_t, UInt_t>(buf, x, n); }
+inline void frombuf(char *&buf, UInt_t *x, Int_t n)    { R__frombufarray<UInt_t, UInt_t>(buf, x, n); }
+inline void frombuf(char *&buf, Long64_t *x, Int_t n)  { R__frombufarray<Long64_t, ULong64_t>(buf, x, n); }
+inline void frombuf(char *&buf, ULong64_t *x, Int_t n) { R__frombufarray<ULong64_t, ULong64_t>(buf, x, n); }
+inline void frombuf(char *&buf, Float_t *x, Int_t n)   { R__frombufarray<Float_t, UInt_t>(buf, x, n); }
+inline void frombuf(char *&buf, Double_t *x, Int_t n)  { R__frombufarray<Double_t, ULong64_t>(buf, x, n); }
+
+
 //______________________________________________________________________________
 #ifdef R__BYTESWAP
 inline UShort_t host2net(UShort_t x)
@@ -114,6 +114,8 @@ public:
    virtual ~TDirectory();
    static  void        AddDirectory(Bool_t add=kTRUE);
    static  Bool_t      AddDirectoryStatus();
+   static  void        AddDirectoryThisThread(Bool_t add=kTRUE);
+   static  Bool_t      AddDirectoryThisThreadStatus();
    virtual void        Append(TObject *obj, Bool_t replace = kFALSE);
    virtual void        Add(TObject *obj, Bool_t replace = kFALSE) { Append(obj,replace); }
    virtual Int_t       AppendKey(TKey *) {return 0;}
@@ -27,6 +27,7 @@
 #include "TMethod.h"
 
 #include "TSpinLockGuard.h"
+#include "ThreadLocalStorage.h"
 
 Bool_t TDirectory::fgAddDirectory = kTRUE;
 
@@ -181,6 +182,46 @@ Bool_t TDirectory::AddDirectoryStatus()
    return fgAddDirectory;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return the flag of the calling thread, see AddDirectoryThisThread.
+
+static Bool_t &AddDirectoryThisThreadFlag()
+{
+   TTHREAD_TLS(Bool_t) add = kTRUE;
+   return add;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Sets the flag controlling the automatic add of the histograms and of the
+/// memory resident trees created by the calling thread only.
+///
+/// With add = kFALSE, the histograms created by the calling thread are not
+/// added to gDirectory, whatever TH1::AddDirectoryStatus(), and the trees it
+/// creates in gROOT are not attached to any directory. These objects are
+/// then created and deleted without taking the locks protecting the lists
+/// of gROOT and without going through the list of cleanups; they are owned
+/// by the caller. gDirectory itself is not changed.
+///
+/// This can be used by the worker threads or tasks creating many temporary
+/// objects:
+/// ~~~ {.cpp}
+///     TDirectory::AddDirectoryThisThread(kFALSE);
+///     TH1F h("h", "h", 100, 0., 1.); // not in gDirectory
+/// ~~~
+
+void TDirectory::AddDirectoryThisThread(Bool_t add)
+{
+   AddDirectoryThisThreadFlag() = add;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Static function: see TDirectory::AddDirectoryThisThread for more comments.
+
+Bool_t TDirectory::AddDirectoryThisThreadStatus()
+{
+   return AddDirectoryThisThreadFlag();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Append object to this directory.
 ///
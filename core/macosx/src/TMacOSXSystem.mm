@@ -19,6 +19,7 @@
 #include "TROOT.h"
 
 #include <stdexcept>
+#include <algorithm>
 #include <vector>
 #include <map>
 #include <set>
@@ -89,44 +90,47 @@ const Int_t kFDSETSIZE = 256;                 // upto 256 file descriptors
 
 class TFdSet {
 private:
-   ULong_t fds_bits[HOWMANY(kFDSETSIZE, kNFDBITS)];
-public:
-   TFdSet() { memset(fds_bits, 0, sizeof(fds_bits)); }
-   TFdSet(const TFdSet &org) { memcpy(fds_bits, org.fds_bits, sizeof(org.fds_bits)); }
-   TFdSet &operator=(const TFdSet &rhs)
+   std::vector<ULong_t> fds_bits;   // grows on demand, not limited to FD_SETSIZE
+   void   Grow(Int_t n)
    {
-      if (this != &rhs) {
-         memcpy(fds_bits, rhs.fds_bits, sizeof(rhs.fds_bits));
-      }
-      return *this;
+      size_t nw = n/kNFDBITS + 1;
+      if (nw > fds_bits.size())
+         fds_bits.resize(nw, 0);
    }
-   void   Zero() { memset(fds_bits, 0, sizeof(fds_bits)); }
+public:
+   TFdSet() : fds_bits(HOWMANY(kFDSETSIZE, kNFDBITS), 0) { }
+   void   Zero() { std::fill(fds_bits.begin(), fds_bits.end(), 0); }
    void   Set(Int_t n)
    {
-      if (n >= 0 && n < kFDSETSIZE) {
+      if (n >= 0) {
+         Grow(n);
          fds_bits[n/kNFDBITS] |= (1UL << (n % kNFDBITS));
       } else {
-         ::Fatal("TFdSet::Set","fd (%d) out of range [0..%d]", n, kFDSETSIZE-1);
+         ::Fatal("TFdSet::Set","fd (%d) out of range", n);
       }
    }
    void   Clr(Int_t n)
    {
-      if (n >= 0 && n < kFDSETSIZE) {
-         fds_bits[n/kNFDBITS] &= ~(1UL << (n % kNFDBITS));
+      if (n >= 0) {
+         if ((size_t)(n/kNFDBITS) < fds_bits.size())
+            fds_bits[n/kNFDBITS] &= ~(1UL << (n % kNFDBITS));
       } else {
-         ::Fatal("TFdSet::Clr","fd (%d) out of range [0..%d]", n, kFDSETSIZE-1);
+         ::Fatal("TFdSet::Clr","fd (%d) out of range", n);
       }
    }
    Int_t  IsSet(Int_t n)
    {
-      if (n >= 0 && n < kFDSETSIZE) {
+      if (n >= 0) {
+         if ((size_t)(n/kNFDBITS) >= fds_bits.size())
+            return 0;
          return (fds_bits[n/kNFDBITS] & (1UL << (n % kNFDBITS))) != 0;
       } else {
-         ::Fatal("TFdSet::IsSet","fd (%d) out of range [0..%d]", n, kFDSETSIZE-1);
+         ::Fatal("TFdSet::IsSet","fd (%d) out of range", n);
          return 0;
       }
    }
-   ULong_t *GetBits() { return (ULong_t *)fds_bits; }
+   ULong_t *GetBits() { return fds_bits.data(); }
+   Int_t  GetNwords() const { return (Int_t)fds_bits.size(); }
 };
 
 namespace ROOT {
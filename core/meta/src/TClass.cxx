@@ -90,6 +90,7 @@ a 'using namespace std;' has been applied to and with:
 #include <assert.h>
 #include <vector>
 #include <memory>
+#include <unordered_map>
 
 #include "TSpinLockGuard.h"
 
@@ -416,6 +417,46 @@ namespace ROOT {
    };
 }
 
+namespace {
+   // Incremented (after the change) each time a class is added to or removed
+   // from the list and maps of classes, and when a class is unloaded; used to
+   // invalidate the per-thread caches.
+   std::atomic<UInt_t> gClassMapGeneration{0};
+
+   // Per-thread cache of the results of TClass::GetClass, used so that, once
+   // warmed-up, the lookups do not need to take any lock. The key is either
+   // the address of the type_info (identical type_info found in distinct
+   // libraries are thus just cached twice) or the class name.
+   template <class Key>
+   struct TClassLookupCache {
+      UInt_t fGeneration = 0;
+      std::unordered_map<Key, TClass *> fMap;
+
+      TClass *Find(const Key &key)
+      {
+         UInt_t generation = gClassMapGeneration.load(std::memory_order_acquire);
+         if (generation != fGeneration) {
+            fMap.clear();
+            fGeneration = generation;
+            return nullptr;
+         }
+         auto iter = fMap.find(key);
+         return iter == fMap.end() ? nullptr : iter->second;
+      }
+
+      void Insert(const Key &key, TClass *cl, UInt_t generation)
+      {
+         // Only record the result if the classes did not change since the lookup
+         // started: generation is the value seen by Find, compare it with the
+         // current one, which is bumped by AddClass/RemoveClass/SetUnloaded.
+         if (generation == fGeneration && generation == gClassMapGeneration.load(std::memory_order_acquire))
+            fMap[key] = cl;
+      }
+   };
+   using TTypeIdCache = TClassLookupCache<const std::type_info *>;
+   using TClassNameCache = TClassLookupCache<std::string>;
+}
+
 IdMap_t *TClass::GetIdMap() {
 
 #ifdef R__COMPLETE_MEM_TERMINATION
@@ -450,6 +491,7 @@ void TClass::AddClass(TClass *cl)
    if (cl->GetTypeInfo()) {
       GetIdMap()->Add(cl->GetTypeInfo()->name(),cl);
    }
+   ++gClassMapGeneration;
    if (cl->fClassInfo) {
       GetDeclIdMap()->Add((void*)(cl->fClassInfo), cl);
    }
@@ -476,6 +518,7 @@ void TClass::RemoveClass(TClass *oldcl)
    if (oldcl->GetTypeInfo()) {
       GetIdMap()->Remove(oldcl->GetTypeInfo()->name());
    }
+   ++gClassMapGeneration;
    if (oldcl->fClassInfo) {
       //GetDeclIdMap()->Remove((void*)(oldcl->fClassInfo));
    }
@@ -2894,14 +2937,27 @@ TClass *TClass::GetClass(const char *name, Bool_t load, Bool_t silent)
 
    if (!gROOT->GetListOfClasses())  return 0;
 
+   // Lock-free lookup of the loaded classes already found by this thread.
+   // The key string is reused to avoid an allocation at each lookup.
+   TTHREAD_TLS_DECL(TClassNameCache, nameCache);
+   TTHREAD_TLS_DECL(std::string, nameKey);
+   nameKey = name;
+   TClass *cl = nameCache.Find(nameKey);
+   if (cl && cl->IsLoaded()) return cl;
+   UInt_t generation = nameCache.fGeneration;
+
    // FindObject will take the read lock before actually getting the
    // TClass pointer so we will need not get a partially initialized
    // object.
-   TClass *cl = (TClass*)gROOT->GetListOfClasses()->FindObject(name);
+   cl = (TClass*)gROOT->GetListOfClasses()->FindObject(name);
 
    // Early return to release the lock without having to execute the
    // long-ish normalization.
-   if (cl && (cl->IsLoaded() || cl->TestBit(kUnloading))) return cl;
+   if (cl && cl->IsLoaded()) {
+      nameCache.Insert(nameKey, cl, generation);
+      return cl;
+   }
+   if (cl && cl->TestBit(kUnloading)) return cl;
 
    R__WRITE_LOCKGUARD(ROOT::gCoreMutex);
 
@@ -3107,12 +3163,21 @@ TClass *TClass::GetClass(const std::type_info& typeinfo, Bool_t load, Bool_t /*
    if (!gROOT->GetListOfClasses())
       return 0;
 
+   // Lock-free lookup of the classes already found by this thread.
+   TTHREAD_TLS_DECL(TTypeIdCache, typeIdCache);
+   TClass* cl = typeIdCache.Find(&typeinfo);
+   if (cl && cl->IsLoaded()) return cl;
+   UInt_t generation = typeIdCache.fGeneration;
+
    //protect access to TROOT::GetIdMap
    R__READ_LOCKGUARD(ROOT::gCoreMutex);
 
-   TClass* cl = GetIdMap()->Find(typeinfo.name());
+   cl = GetIdMap()->Find(typeinfo.name());
 
-   if (cl && cl->IsLoaded()) return cl;
+   if (cl && cl->IsLoaded()) {
+      typeIdCache.Insert(&typeinfo, cl, generation);
+      return cl;
+   }
 
    R__WRITE_LOCKGUARD(ROOT::gCoreMutex);
 
@@ -5986,6 +6051,9 @@ void TClass::SetUnloaded()
       return;
    }
    SetBit(kUnloading);
+   // The per-thread caches of GetClass(const std::type_info&) must not return
+   // this class anymore: its type_info might be reused by a library loaded later.
+   ++gClassMapGeneration;
 
    //R__ASSERT(fState == kLoaded);
    if (fState != kLoaded) {
@@ -0,0 +1,101 @@
+#include "TClass.h"
+#include "TList.h"
+#include "TNamed.h"
+#include "TObject.h"
+#include "TROOT.h"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+TEST(TClassGetClass, TypeInfoConcurrent)
+{
+   ROOT::EnableThreadSafety();
+
+   const int nThreads = 8;
+   const int nIterations = 10000;
+   std::atomic<int> nErrors{0};
+
+   auto lookup = [&]() {
+      for (int i = 0; i < nIterations; ++i) {
+         if (TClass::GetClass(typeid(TObject)) != TObject::Class())
+            ++nErrors;
+         if (TClass::GetClass(typeid(TNamed)) != TNamed::Class())
+            ++nErrors;
+         if (TClass::GetClass(typeid(TList)) != TList::Class())
+            ++nErrors;
+      }
+   };
+
+   std::vector<std::thread> threads;
+   for (int i = 0; i < nThreads; ++i)
+      threads.emplace_back(lookup);
+   for (auto &t : threads)
+      t.join();
+
+   EXPECT_EQ(0, nErrors.load());
+}
+
+TEST(TClassGetClass, NameConcurrent)
+{
+   ROOT::EnableThreadSafety();
+
+   const int nThreads = 8;
+   const int nIterations = 10000;
+   std::atomic<int> nErrors{0};
+
+   auto lookup = [&]() {
+      for (int i = 0; i < nIterations; ++i) {
+         if (TClass::GetClass("TObject") != TObject::Class())
+            ++nErrors;
+         if (TClass::GetClass("TNamed") != TNamed::Class())
+            ++nErrors;
+         if (TClass::GetClass("class TList") != TList::Class())
+            ++nErrors;
+      }
+   };
+
+   std::vector<std::thread> threads;
+   for (int i = 0; i < nThreads; ++i)
+      threads.emplace_back(lookup);
+   for (auto &t : threads)
+      t.join();
+
+   EXPECT_EQ(0, nErrors.load());
+}
+
+// The warmed-up lookups, served by the per-thread caches, must give the same
+// result for any number of concurrent threads.
+TEST(TClassGetClass, TypeInfoManyThreads)
+{
+   ROOT::EnableThreadSafety();
+
+   const int nIterations = 20000;
+   const unsigned maxThreads = std::max(2u, std::thread::hardware_concurrency());
+
+   for (unsigned nThreads = 1; nThreads <= maxThreads; nThreads *= 2) {
+      std::atomic<int> nErrors{0};
+      auto lookup = [&](unsigned ithread) {
+         for (int i = 0; i < nIterations; ++i) {
+            // alternate the order of the lookups between threads
+            if ((i + ithread) % 2) {
+               if (TClass::GetClass(typeid(TNamed)) != TNamed::Class())
+                  ++nErrors;
+            } else if (TClass::GetClass(typeid(TList)) != TList::Class()) {
+               ++nErrors;
+            }
+         }
+      };
+
+      std::vector<std::thread> threads;
+      for (unsigned i = 0; i < nThreads; ++i)
+         threads.emplace_back(lookup, i);
+      for (auto &t : threads)
+         t.join();
+
+      EXPECT_EQ(0, nErrors.load()) << "with " << nThreads << " threads";
+   }
+}
@@ -907,6 +907,8 @@ void **TThread::GetTls(Int_t k) {
    // to zero which is 'unexpected')
    // We initialize it to gROOT rather than gDirectory, since
    // TFile are currently expected to not be shared by two threads.
+   // To create objects that are not registered in any directory, see
+   // TDirectory::AddDirectoryThisThread.
    if (k == ROOT::kDirectoryThreadSlot && tls[k] == nullptr)
       tls[k] = gROOT;
 
@@ -0,0 +1,59 @@
+#include "TDirectory.h"
+#include "TH1F.h"
+#include "TROOT.h"
+#include "TTree.h"
+
+#include <thread>
+
+#include "gtest/gtest.h"
+
+TEST(ThreadDirectory, DefaultIsROOT)
+{
+   ROOT::EnableThreadSafety();
+
+   TDirectory *dir = nullptr;
+   std::thread t([&dir]() { dir = gDirectory; });
+   t.join();
+   EXPECT_EQ(gROOT, dir);
+}
+
+TEST(ThreadDirectory, NullDirectoryIsReset)
+{
+   ROOT::EnableThreadSafety();
+
+   std::thread t([]() {
+      {
+         TDirectory::TContext ctx(nullptr);
+      }
+      // a null gDirectory is not kept, the objects are registered in gROOT
+      EXPECT_EQ(gROOT, gDirectory);
+   });
+   t.join();
+}
+
+TEST(ThreadDirectory, NoRegistrationThisThread)
+{
+   ROOT::EnableThreadSafety();
+
+   std::thread t([]() {
+      TDirectory::AddDirectoryThisThread(kFALSE);
+      EXPECT_FALSE(TDirectory::AddDirectoryThisThreadStatus());
+
+      // the objects must not be registered in gROOT
+      TH1F h("threadhist", "threadhist", 10, 0., 1.);
+      EXPECT_EQ(gROOT, gDirectory);
+      EXPECT_EQ(nullptr, h.GetDirectory());
+      EXPECT_FALSE(h.TestBit(kMustCleanup));
+      EXPECT_EQ(nullptr, gROOT->FindObject("threadhist"));
+
+      TTree tree("threadtree", "threadtree");
+      EXPECT_EQ(nullptr, tree.GetDirectory());
+      EXPECT_EQ(nullptr, gROOT->FindObject("threadtree"));
+   });
+   t.join();
+
+   // the other threads are not affected
+   EXPECT_TRUE(TDirectory::AddDirectoryThisThreadStatus());
+   TH1F h("mainhist", "mainhist", 10, 0., 1.);
+   EXPECT_EQ(gDirectory, h.GetDirectory());
+}
@@ -38,6 +38,7 @@
 #include "TObjArray.h"
 #include <map>
 #include <algorithm>
+#include <vector>
 #include <atomic>
 
 //#define G__OLDEXPAND
@@ -99,6 +100,7 @@
 #include <time.h>
 #include <sys/time.h>
 #include <sys/file.h>
+#include <poll.h>
 #include <sys/socket.h>
 #include <netinet/in.h>
 #include <netinet/tcp.h>
@@ -365,40 +367,93 @@ const Int_t kFDSETSIZE = 256;                 // upto 256 file descriptors
 
 class TFdSet {
 private:
-   ULong_t fds_bits[HOWMANY(kFDSETSIZE, kNFDBITS)];
+   std::vector<ULong_t> fds_bits;   // grows on demand, not limited to FD_SETSIZE
+   void   Grow(Int_t n)
+   {
+      size_t nw = n/kNFDBITS + 1;
+      if (nw > fds_bits.size())
+         fds_bits.resize(nw, 0);
+   }
 public:
-   TFdSet() { memset(fds_bits, 0, sizeof(fds_bits)); }
-   TFdSet(const TFdSet &org) { memcpy(fds_bits, org.fds_bits, sizeof(org.fds_bits)); }
-   TFdSet &operator=(const TFdSet &rhs) { if (this != &rhs) { memcpy(fds_bits, rhs.fds_bits, sizeof(rhs.fds_bits));} return *this; }
-   void   Zero() { memset(fds_bits, 0, sizeof(fds_bits)); }
+   TFdSet() : fds_bits(HOWMANY(kFDSETSIZE, kNFDBITS), 0) { }
+   void   Zero() { std::fill(fds_bits.begin(), fds_bits.end(), 0); }
    void   Set(Int_t n)
    {
-      if (n >= 0 && n < kFDSETSIZE) {
+      if (n >= 0) {
+         Grow(n);
          fds_bits[n/kNFDBITS] |= (1UL << (n % kNFDBITS));
       } else {
-         ::Fatal("TFdSet::Set","fd (%d) out of range [0..%d]", n, kFDSETSIZE-1);
+         ::Fatal("TFdSet::Set","fd (%d) out of range", n);
       }
    }
    void   Clr(Int_t n)
    {
-      if (n >= 0 && n < kFDSETSIZE) {
-         fds_bits[n/kNFDBITS] &= ~(1UL << (n % kNFDBITS));
+      if (n >= 0) {
+         if ((size_t)(n/kNFDBITS) < fds_bits.size())
+            fds_bits[n/kNFDBITS] &= ~(1UL << (n % kNFDBITS));
       } else {
-         ::Fatal("TFdSet::Clr","fd (%d) out of range [0..%d]", n, kFDSETSIZE-1);
+         ::Fatal("TFdSet::Clr","fd (%d) out of range", n);
       }
    }
    Int_t  IsSet(Int_t n)
    {
-      if (n >= 0 && n < kFDSETSIZE) {
+      if (n >= 0) {
+         if ((size_t)(n/kNFDBITS) >= fds_bits.size())
+            return 0;
          return (fds_bits[n/kNFDBITS] & (1UL << (n % kNFDBITS))) != 0;
       } else {
-         ::Fatal("TFdSet::IsSet","fd (%d) out of range [0..%d]", n, kFDSETSIZE-1);
+         ::Fatal("TFdSet::IsSet","fd (%d) out of range", n);
          return 0;
       }
    }
-   ULong_t *GetBits() { return (ULong_t *)fds_bits; }
+   ULong_t *GetBits() { return fds_bits.data(); }
+   Int_t  GetNwords() const { return (Int_t)fds_bits.size(); }
 };
 
+////////////////////////////////////////////////////////////////////////////////
+/// Wait with poll() for the events requested in fds or for timeout (in
+/// milliseconds) to occur. Same return codes as UnixSelect(). Unlike
+/// select() there is no limit on the value of the file descriptors and the
+/// cost only depends on the number of entries in fds.
+
+static int UnixPoll(std::vector<struct pollfd> &fds, Long_t timeout)
+{
+   int to = (timeout < 0) ? -1 : (int) TMath::Min(timeout, (Long_t) kMaxInt);
+   int retcode = poll(fds.data(), (nfds_t) fds.size(), to);
+   if (retcode == -1) {
+      if (TSystem::GetErrno() == EINTR) {
+         TSystem::ResetErrno();  // errno is not self reseting
+         return -2;
+      }
+      return -1;
+   }
+   // select() fails with EBADF if any of the descriptors is invalid,
+   // keep that behaviour for the callers relying on it
+   if (retcode > 0) {
+      for (auto &pfd : fds) {
+         if (pfd.revents & POLLNVAL) {
+            errno = EBADF;
+            return -3;
+         }
+      }
+   }
+   return retcode;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Readiness of a poll() result, mapped onto the select() semantics: hang-ups
+/// and errors make a descriptor readable, errors also make it writable.
+
+static inline Bool_t UnixPollReadReady(const struct pollfd &pfd)
+{
+   return (pfd.revents & (POLLIN | POLLPRI | POLLHUP | POLLERR)) != 0;
+}
+
+static inline Bool_t UnixPollWriteReady(const struct pollfd &pfd)
+{
+   return (pfd.revents & (POLLOUT | POLLERR)) != 0;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Unix signal handler.
 
@@ -1171,36 +1226,47 @@ Int_t TUnixSystem::Select(TList *act, Long_t to)
 {
    Int_t rc = -4;
 
-   TFdSet rd, wr;
-   Int_t mxfd = -1;
+   // one poll entry per interested handler, the readiness is then set
+   // directly on the handlers without going through descriptor masks
+   std::vector<struct pollfd> fds;
+   std::vector<TFileHandler *> hds;
+   fds.reserve(act->GetSize());
+   hds.reserve(act->GetSize());
    TIter next(act);
    TFileHandler *h = 0;
    while ((h = (TFileHandler *) next())) {
       Int_t fd = h->GetFd();
       if (fd > -1) {
-         if (h->HasReadInterest()) {
-            rd.Set(fd);
-            mxfd = TMath::Max(mxfd, fd);
-         }
-         if (h->HasWriteInterest()) {
-            wr.Set(fd);
-            mxfd = TMath::Max(mxfd, fd);
-         }
+         struct pollfd pfd;
+         pfd.fd      = fd;
+         pfd.events  = 0;
+         pfd.revents = 0;
+         if (h->HasReadInterest())
+            pfd.events |= POLLIN;
+         if (h->HasWriteInterest())
+            pfd.events |= POLLOUT;
          h->ResetReadyMask();
+         if (pfd.events) {
+            fds.push_back(pfd);
+            hds.push_back(h);
+         }
       }
    }
-   if (mxfd > -1)
-      rc = UnixSelect(mxfd+1, &rd, &wr, to);
+   if (!fds.empty())
+      rc = UnixPoll(fds, to);
 
    // Set readiness bits
    if (rc > 0) {
-      next.Reset();
-      while ((h = (TFileHandler *) next())) {
-         Int_t fd = h->GetFd();
-         if (rd.IsSet(fd))
-            h->SetReadReady();
-         if (wr.IsSet(fd))
-            h->SetWriteReady();
+      rc = 0;
+      for (size_t i = 0; i < fds.size(); i++) {
+         if ((fds[i].events & POLLIN) && UnixPollReadReady(fds[i])) {
+            hds[i]->SetReadReady();
+            rc++;
+         }
+         if ((fds[i].events & POLLOUT) && UnixPollWriteReady(fds[i])) {
+            hds[i]->SetWriteReady();
+            rc++;
+         }
       }
    }
 
@@ -3872,31 +3938,59 @@ int TUnixSystem::UnixSetitimer(Long_t ms)
 /// the number of ready descriptors, or 0 in case of timeout, or < 0 in
 /// case of an error, with -2 being EINTR and -3 EBADF. In case of EINTR
 /// the errno has been reset and the method can be called again.
+/// Implemented with poll(), so descriptors >= FD_SETSIZE are supported.
 
 int TUnixSystem::UnixSelect(Int_t nfds, TFdSet *readready, TFdSet *writeready,
                             Long_t timeout)
 {
-   int retcode;
+   std::vector<struct pollfd> fds;
+
+   // collect the requested descriptors, skipping empty words of the masks
+   Int_t nrw = readready  ? TMath::Min(readready->GetNwords(),  (Int_t) HOWMANY(nfds, kNFDBITS)) : 0;
+   Int_t nww = writeready ? TMath::Min(writeready->GetNwords(), (Int_t) HOWMANY(nfds, kNFDBITS)) : 0;
+   Int_t nw  = TMath::Max(nrw, nww);
+   for (Int_t w = 0; w < nw; w++) {
+      ULong_t rbits = (w < nrw) ? readready->GetBits()[w]  : 0;
+      ULong_t wbits = (w < nww) ? writeready->GetBits()[w] : 0;
+      ULong_t bits  = rbits | wbits;
+      for (Int_t b = 0; bits && b < kNFDBITS; b++, bits >>= 1) {
+         if (!(bits & 1UL))
+            continue;
+         Int_t fd = w * kNFDBITS + b;
+         if (fd >= nfds)
+            break;
+         struct pollfd pfd;
+         pfd.fd      = fd;
+         pfd.events  = 0;
+         pfd.revents = 0;
+         if (rbits & (1UL << b))
+            pfd.events |= POLLIN;
+         if (wbits & (1UL << b))
+            pfd.events |= POLLOUT;
+         fds.push_back(pfd);
+      }
+   }
 
-   fd_set *rd = (readready)  ? (fd_set*)readready->GetBits()  : 0;
-   fd_set *wr = (writeready) ? (fd_set*)writeready->GetBits() : 0;
+   if (readready)
+      readready->Zero();
+   if (writeready)
+      writeready->Zero();
 
-   if (timeout >= 0) {
-      struct timeval tv;
-      tv.tv_sec  = Int_t(timeout / 1000);
-      tv.tv_usec = (timeout % 1000) * 1000;
-      retcode = select(nfds, rd, wr, 0, &tv);
-   } else {
-      retcode = select(nfds, rd, wr, 0, 0);
-   }
-   if (retcode == -1) {
-      if (GetErrno() == EINTR) {
-         ResetErrno();  // errno is not self reseting
-         return -2;
+   int retcode = UnixPoll(fds, timeout);
+   if (retcode <= 0)
+      return retcode;
+
+   // like select(), count each descriptor once per mask it is ready in
+   retcode = 0;
+   for (auto &pfd : fds) {
+      if ((pfd.events & POLLIN) && UnixPollReadReady(pfd)) {
+         readready->Set(pfd.fd);
+         retcode++;
+      }
+      if ((pfd.events & POLLOUT) && UnixPollWriteReady(pfd)) {
+         writeready->Set(pfd.fd);
+         retcode++;
       }
-      if (GetErrno() == EBADF)
-         return -3;
-      return -1;
    }
 
    return retcode;
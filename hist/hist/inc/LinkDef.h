@@ -53,6 +53,7 @@
 #pragma link C++ class TGraph2DErrors-;
 #pragma link C++ class TGraphDelaunay+;
 #pragma link C++ class TGraphDelaunay2D+;
+#pragma link C++ class TGraphInterpolator+;
 #pragma link C++ class TGraphSmooth+;
 #pragma link C++ class TGraphTime+;
 #pragma link C++ class TH1-;
@@ -67,6 +68,8 @@
 #pragma link C++ class TH2D-;
 #pragma link C++ class TH2F-;
 #pragma link C++ class TH2Poly+;
+#pragma read sourceClass="TH2Poly" targetClass="TH2Poly" version="[1-]" source="" target="" \
+  code="{ newObj->ResetBinTree(); }"
 #pragma link C++ class TH2PolyBin+;
 #pragma link C++ class TProfile2Poly+;
 #pragma link C++ class TProfile2PolyBin+;
@@ -139,6 +139,20 @@ namespace ROOT {
          /// By calling this method the class manages now the passed TF1 pointer
          void SetAndCopyFunction(const TF1 *f = 0);
 
+         /// use for the parameter gradient the exact derivatives of the function formula,
+         /// generated with TFormula::GenerateGradientPar (as for the fit option "G").
+         /// If the gradient has not been generated the numerical derivatives are used
+         void SetUseFormulaGradient(bool on = true)
+         {
+            fUseFormulaGradient = on;
+         }
+
+         /// return true if the exact derivatives of the function formula are used
+         bool UseFormulaGradient() const
+         {
+            return fUseFormulaGradient;
+         }
+
       private:
          /// evaluate function passing coordinates x and vector of parameters
          T DoEvalPar(const T *x, const double *p) const
@@ -146,6 +160,30 @@ namespace ROOT {
             return fFunc->EvalPar(x, p);
          }
 
+         /// evaluate function at n points using TF1::EvalN
+         void DoEvalN(unsigned int n, const T *x, T *result, const double *p) const
+         {
+            EvalNImpl(n, x, result, p);
+         }
+
+         void EvalNImpl(unsigned int n, const double *x, double *result, const double *p) const
+         {
+            // TF1::EvalN expects the points with a stride equal to the TF1 dimension
+            if (fDim == (unsigned int)fFunc->GetNdim()) {
+               fFunc->EvalN(n, x, result, p);
+               return;
+            }
+            for (unsigned int i = 0; i < n; ++i)
+               result[i] = fFunc->EvalPar(x + i * fDim, p);
+         }
+
+         template <class U>
+         void EvalNImpl(unsigned int n, const U *x, U *result, const double *p) const
+         {
+            for (unsigned int i = 0; i < n; ++i)
+               result[i] = fFunc->EvalPar(x + i * fDim, p);
+         }
+
          /// evaluate function using the cached parameter values (of TF1)
          /// re-implement for better efficiency
          T DoEvalVec(const T *x) const
@@ -169,6 +207,7 @@ namespace ROOT {
          bool fLinear;                 // flag for linear functions
          bool fPolynomial;             // flag for polynomial functions
          bool fOwnFunc;                 // flag to indicate we own the TF1 function pointer
+         bool fUseFormulaGradient;      // flag to use the gradient generated for the TF1 formula
          TF1 *fFunc;                    // pointer to ROOT function
          unsigned int fDim;             // cached value of dimension
          //std::vector<double> fParams;   // cached vector with parameter values
@@ -207,12 +246,44 @@ namespace ROOT {
          }
       };
 
+      /**
+       * Auxiliar class to compute the parameter gradient with the function generated by
+       * TFormula::GenerateGradientPar, which exists only for double. The general implementation
+       * returns false, so that the numerical derivatives are used.
+       */
+      template <class T>
+      struct FormulaGradientParameterDerivation {
+         static bool ParameterGradient(const WrappedMultiTF1Templ<T> *, const T *, const double *, T *)
+         {
+            return false;
+         }
+      };
+
+      template <>
+      struct FormulaGradientParameterDerivation<double> {
+         static bool
+         ParameterGradient(const WrappedMultiTF1Templ<double> *wrappedFunc, const double *x, const double *p, double *grad)
+         {
+            const TF1 *f = wrappedFunc->GetFunction();
+            const TFormula *formula = f->GetFormula();
+            if (f->IsEvalNormalized() || !formula || !formula->GradientPar(x, grad, p)) return false;
+            // as TF1::GradientPar, return 0 for the fixed parameters
+            double al, bl;
+            for (int ipar = 0; ipar < f->GetNpar(); ++ipar) {
+               f->GetParLimits(ipar, al, bl);
+               if (al * bl != 0 && al >= bl) grad[ipar] = 0;
+            }
+            return true;
+         }
+      };
+
       // implementations for WrappedMultiTF1Templ<T>
       template<class T>
       WrappedMultiTF1Templ<T>::WrappedMultiTF1Templ(TF1 &f, unsigned int dim)  :
          fLinear(false),
          fPolynomial(false),
          fOwnFunc(false),
+         fUseFormulaGradient(false),
          fFunc(&f),
          fDim(dim)
          //fParams(f.GetParameters(),f.GetParameters()+f.GetNpar())
@@ -246,6 +317,7 @@ namespace ROOT {
          fLinear(rhs.fLinear),
          fPolynomial(rhs.fPolynomial),
          fOwnFunc(rhs.fOwnFunc),
+         fUseFormulaGradient(rhs.fUseFormulaGradient),
          fFunc(rhs.fFunc),
          fDim(rhs.fDim)
          //fParams(rhs.fParams)
@@ -262,6 +334,7 @@ namespace ROOT {
          fLinear = rhs.fLinear;
          fPolynomial = rhs.fPolynomial;
          fOwnFunc = rhs.fOwnFunc;
+         fUseFormulaGradient = rhs.fUseFormulaGradient;
          fDim = rhs.fDim;
          //fParams = rhs.fParams;
          return *this;
@@ -276,6 +349,8 @@ namespace ROOT {
          //  so in case of fLinear (or fPolynomial) a non-zero value will be returned for fixed parameters
 
          if (!fLinear) {
+            if (fUseFormulaGradient && FormulaGradientParameterDerivation<T>::ParameterGradient(this, x, par, grad))
+               return;
             // need to set parameter values
             fFunc->SetParameters(par);
             // no need to call InitArgs (it is called in TF1::GradientPar)
@@ -294,6 +369,11 @@ namespace ROOT {
          // evaluate the derivative of the function with respect to parameter ipar
          // see note above concerning the fixed parameters
          if (!fLinear) {
+            if (fUseFormulaGradient) {
+               std::vector<T> grad(NPar());
+               if (FormulaGradientParameterDerivation<T>::ParameterGradient(this, x, p, grad.data()))
+                  return grad[ipar];
+            }
             fFunc->SetParameters(p);
             double prec = this->GetDerivPrecision();
             return fFunc->GradientPar(ipar, x, prec);
@@ -21,6 +21,7 @@
 #include <vector>
 #include <list>
 #include <map>
+#include <atomic>
 #include <Math/Types.h>
 
 class TFormulaFunction
@@ -99,6 +100,9 @@ private:
 
    TInterpreter::CallFuncIFacePtr_t::Generic_t fFuncPtr;   //!  function pointer
    void *   fLambdaPtr;                                    //!  pointer to the lambda function
+   std::string       fClingExpression;   //! expression used to build the batched evaluation and the gradient functions
+   std::atomic<TInterpreter::CallFuncIFacePtr_t::Generic_t> fBatchFuncPtr{nullptr};  //! pointer to the batched evaluation function (see EvalN)
+   TInterpreter::CallFuncIFacePtr_t::Generic_t fGradFuncPtr = nullptr;   //! pointer to the gradient function generated with clad
 
    void     InputFormulaIntoCling();
    Bool_t   PrepareEvalMethod();
@@ -115,6 +119,7 @@ private:
    void FillParametrizedFunctions(std::map<std::pair<TString, Int_t>, std::pair<TString, TString>> &functions);
    void FillVecFunctionsShurtCuts();
    void ReInitializeEvalMethod(); 
+   Bool_t   PrepareBatchMethod();
 
 protected:
 
@@ -178,6 +183,10 @@ public:
    Double_t       Eval(Double_t x, Double_t y , Double_t z) const;
    Double_t       Eval(Double_t x, Double_t y , Double_t z , Double_t t ) const;
    Double_t       EvalPar(const Double_t *x, const Double_t *params=0) const;
+   void           EvalN(Int_t n, const Double_t *x, Double_t *result, const Double_t *params = nullptr) const;
+   Bool_t         GenerateGradientPar();
+   Bool_t         GradientPar(const Double_t *x, Double_t *result, const Double_t *params = nullptr) const;
+   Bool_t         HasGeneratedGradient() const { return fGradFuncPtr != nullptr; }
    // template <class T>
    // T Eval(T x, T y = 0, T z = 0, T t = 0) const;
    template <class T>
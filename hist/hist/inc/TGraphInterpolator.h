@@ -0,0 +1,53 @@
+// @(#)root/hist:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2019, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_TGraphInterpolator
+#define ROOT_TGraphInterpolator
+
+#include "Rtypes.h"
+
+#include <memory>
+#include <vector>
+
+class TGraph;
+class TSpline3;
+
+class TGraphInterpolator {
+
+private:
+   std::vector<Double_t>     fX;          ///< Abscissas of the points, in increasing order
+   std::vector<Double_t>     fY;          ///< Ordinates of the points
+   Bool_t                    fUniform;    ///< True if the abscissas are equidistant
+   Double_t                  fInvDelta;   ///< Inverse of the distance between equidistant abscissas
+   std::unique_ptr<TSpline3> fSpline;     ///< Cubic spline through the points (option "S")
+
+   void     Init(Int_t n, const Double_t *x, const Double_t *y, Option_t *option);
+   Int_t    FindLow(Double_t x) const;
+   Double_t Interpolate(Double_t x, Int_t low) const;
+
+public:
+   TGraphInterpolator(const TGraph &g, Option_t *option = "");
+   TGraphInterpolator(Int_t n, const Double_t *x, const Double_t *y, Option_t *option = "");
+   TGraphInterpolator(const TGraphInterpolator &) = delete;
+   TGraphInterpolator &operator=(const TGraphInterpolator &) = delete;
+   virtual ~TGraphInterpolator();
+
+   Double_t  Eval(Double_t x) const;
+   void      EvalN(Int_t n, const Double_t *x, Double_t *result) const;
+   Int_t     GetN() const { return fX.size(); }
+   Bool_t    IsUniform() const { return fUniform; }
+   const TSpline3 *GetSpline() const { return fSpline.get(); }
+
+   Double_t operator()(Double_t x) const { return Eval(x); }
+
+   ClassDef(TGraphInterpolator, 0) // Cached interpolation of the points of a TGraph
+};
+
+#endif
@@ -22,6 +22,8 @@
 
 #include "TH2.h"
 
+#include <atomic>
+
 class TH2PolyBin: public TObject{
 
 public:
@@ -62,6 +64,7 @@ class TList;
 class TGraph;
 class TMultiGraph;
 class TPad;
+class TH2PolyBinTree;
 
 class TH2Poly : public TH2 {
 
@@ -115,6 +118,7 @@ public:
    Double_t     Integral(Int_t, Int_t, Int_t, Int_t, Int_t, Int_t, const Option_t*) const{return 0;} //MayNotUse
    Long64_t     Merge(TCollection *);
    virtual void Reset(Option_t *option);
+   void         ResetBinTree();                     // Discards the spatial index of the bins, e.g. after reading
    virtual void Scale(Double_t c1 = 1, Option_t* option = "");
    void         SavePrimitive(std::ostream& out, Option_t* option = "");
    void         SetBinContent(Int_t bin, Double_t content);
@@ -143,8 +147,12 @@ protected:
    Bool_t   fFloat;             //When set to kTRUE, allows the histogram to expand if a bin outside the limits is added.
    Bool_t   fNewBinAdded;       //!For the 3D Painter
    Bool_t   fBinContentChanged; //!For the 3D Painter
+   std::atomic<TH2PolyBinTree*> fBinTree; //!Spatial index of the bins used by FindBin() and Fill(), built once on demand
 
    void   AddBinToPartition(TH2PolyBin *bin);  // Adds the input bin into the partition matrix
+   Int_t  FillBin(TH2PolyBin *bin, Double_t x, Double_t y, Double_t w);
+   Int_t  FillOverflow(Double_t x, Double_t y, Double_t w);
+   const TH2PolyBinTree *GetBinTree();
    void   Initialize(Double_t xlow, Double_t xup, Double_t ylow, Double_t yup, Int_t n, Int_t m);
    Bool_t IsIntersecting(TH2PolyBin *bin, Double_t xclipl, Double_t xclipr, Double_t yclipb, Double_t yclipt);
    Bool_t IsIntersectingPolygon(Int_t bn, Double_t *x, Double_t *y, Double_t xclipl, Double_t xclipr, Double_t yclipb, Double_t yclipt);
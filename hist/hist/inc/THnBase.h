@@ -153,6 +153,8 @@ private:
       return bin;
    }
 
+   virtual void FillN(Int_t n, const Double_t *x, const Double_t *w = nullptr);
+
    virtual void FillBin(Long64_t bin, Double_t w) = 0;
 
    void SetBinEdges(Int_t idim, const Double_t* bins);
@@ -32,14 +32,14 @@
 #include "TArrayC.h"
 
 class THnSparseCompactBinCoord;
+class THnSparseBinHash;
 
 class THnSparse: public THnBase {
  private:
    Int_t      fChunkSize;    // number of entries for each chunk
    Long64_t   fFilledBins;   // number of filled bins
    TObjArray  fBinContent;   // array of THnSparseArrayChunk
-   TExMap     fBins;         //! filled bins
-   TExMap     fBinsContinued;//! filled bins for non-unique hashes, containing pairs of (bin index 0, bin index 1)
+   THnSparseBinHash *fBinHash; //! translation of filled bins' coordinates into their linear index
    THnSparseCompactBinCoord *fCompactCoord; //! compact coordinate
 
    THnSparse(const THnSparse&); // Not implemented
@@ -55,6 +55,7 @@ class THnSparse: public THnBase {
    THnSparseArrayChunk* GetChunk(Int_t idx) const {
       return (THnSparseArrayChunk*) fBinContent[idx]; }
 
+   THnSparseBinHash* GetBinHash();
    THnSparseArrayChunk* AddChunk();
    void Reserve(Long64_t nbins);
    void FillExMap();
@@ -63,6 +63,11 @@ public:
       kForcedBinning
    };
 
+   enum EEvaluation { // KDE evaluation option
+      kExact, // Sum the kernels of all data points (or bins) for each evaluation
+      kFFT    // Convolve the data binned on a fine grid with the kernel via FFT, and interpolate
+   };
+
    explicit TKDE(UInt_t events = 0, const Double_t* data = 0, Double_t xMin = 0.0, Double_t xMax = 0.0, const Option_t* option =
                  "KernelType:Gaussian;Iteration:Adaptive;Mirror:noMirror;Binning:RelaxedBinning", Double_t rho = 1.0) {
       Instantiate( nullptr,  events, data, nullptr, xMin, xMax, option, rho);
@@ -92,6 +97,7 @@ public:
    void SetBinning(EBinning);
    void SetNBins(UInt_t nbins);
    void SetUseBinsNEvents(UInt_t nEvents);
+   void SetEvaluation(EEvaluation eval, UInt_t ngrid = 0);
    void SetTuneFactor(Double_t rho);
    void SetRange(Double_t xMin, Double_t xMax); // By default computed from the data
 
@@ -153,6 +159,7 @@ private:
    EIteration fIteration;
    EMirror fMirror;
    EBinning fBinning;
+   EEvaluation fEvaluation;
 
    Bool_t fUseMirroring, fMirrorLeft, fMirrorRight, fAsymLeft, fAsymRight;
    Bool_t fUseBins;
@@ -160,6 +167,7 @@ private:
    Bool_t fUseMinMaxFromData; // flag top control if min and max must be used from data
 
    UInt_t fNBins;          // Number of bins for binned data option
+   UInt_t fNGrid;          // Number of grid points for the FFT evaluation option (0: chosen from the bandwidth)
    UInt_t fNEvents;        // Data's number of events
    Double_t fSumOfCounts; // Data sum of weights
    UInt_t fUseBinsNEvents; // If the algorithm is allowed to use binning this is the minimum number of events to do so
@@ -246,7 +254,7 @@ private:
    TF1* GetPDFUpperConfidenceInterval(Double_t confidenceLevel = 0.95, UInt_t npx = 100, Double_t xMin = 1.0, Double_t xMax = 0.0);
    TF1* GetPDFLowerConfidenceInterval(Double_t confidenceLevel = 0.95, UInt_t npx = 100, Double_t xMin = 1.0, Double_t xMax = 0.0);
 
-   ClassDef(TKDE, 2) // One dimensional semi-parametric Kernel Density Estimation
+   ClassDef(TKDE, 3) // One dimensional semi-parametric Kernel Density Estimation
 
 };
 
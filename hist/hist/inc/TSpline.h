@@ -57,6 +57,7 @@ public:
    virtual Double_t GetXmax()  const {return fXmax;}
    virtual void     Paint(Option_t *option="");
    virtual Double_t Eval(Double_t x) const=0;
+   virtual void     EvalN(Int_t n, const Double_t *x, Double_t *result) const;
    virtual void     SaveAs(const char * /*filename*/,Option_t * /*option*/) const {;}
    void             SetNpx(Int_t n) {fNpx=n;}
 
@@ -196,13 +197,14 @@ protected:
    Double_t       fValEnd;     // End value of first or second derivative
    Int_t          fBegCond;    // 0=no beg cond, 1=first derivative, 2=second derivative
    Int_t          fEndCond;    // 0=no end cond, 1=first derivative, 2=second derivative
+   Double_t       fInvDelta;   //! Inverse of the distance between knots found to be equidistant, 0 otherwise
 
    void   BuildCoeff();
    void   SetCond(const char *opt);
 
 public:
    TSpline3() : TSpline() , fPoly(0), fValBeg(0), fValEnd(0),
-      fBegCond(-1), fEndCond(-1) {}
+      fBegCond(-1), fEndCond(-1), fInvDelta(0) {}
    TSpline3(const char *title,
             Double_t x[], Double_t y[], Int_t n, const char *opt=0,
             Double_t valbeg=0, Double_t valend=0);
@@ -226,6 +228,7 @@ public:
    TSpline3& operator=(const TSpline3&);
    Int_t    FindX(Double_t x) const;
    Double_t Eval(Double_t x) const;
+   void     EvalN(Int_t n, const Double_t *x, Double_t *result) const;
    Double_t Derivative(Double_t x) const;
    virtual ~TSpline3() {if (fPoly) delete [] fPoly;}
    void GetCoeff(Int_t i, Double_t &x, Double_t &y, Double_t &b,
@@ -56,6 +56,8 @@ namespace HFit {
 
    int CheckFitFunction(const TF1 * f1, int hdim);
 
+   bool HasFormulaGradient(TF1 * f1);
+
 
    void GetFunctionRange(const TF1 & f1, ROOT::Fit::DataRange & range);
 
@@ -118,6 +120,18 @@ int HFit::CheckFitFunction(const TF1 * f1, int dim) {
 }
 
 
+bool HFit::HasFormulaGradient(TF1 * f1) {
+   // Check if the function provides the exact gradient with respect to the parameters.
+   // For functions defined by a formula the gradient is generated here with clad
+   // (see TFormula::GenerateGradientPar), when ROOT is built with it.
+   // To be called only for the fits with option "G"
+   if (f1->IsEvalNormalized()) return false;
+   TFormula * formula = f1->GetFormula();
+   if (!formula) return false;
+   return formula->GenerateGradientPar();
+}
+
+
 void HFit::GetFunctionRange(const TF1 & f1, ROOT::Fit::DataRange & range) {
    // get the range form the function and fill and return the DataRange object
    Double_t fxmin, fymin, fzmin, fxmax, fymax, fzmax;
@@ -233,8 +247,12 @@ TFitResultPtr HFit::Fit(FitObject * h1, TF1 *f1 , Foption_t & fitOption , const
 
    // set the fit function
    // if option grad is specified use gradient
-   if ( (linear || fitOption.Gradient) )
-      fitter->SetFunction(ROOT::Math::WrappedMultiTF1(*f1));
+   // for a formula the exact gradient is then generated, when possible
+   if ( (linear || fitOption.Gradient) ) {
+      ROOT::Math::WrappedMultiTF1 wf(*f1);
+      if (fitOption.Gradient) wf.SetUseFormulaGradient(HFit::HasFormulaGradient(f1));
+      fitter->SetFunction(wf);
+   }
 #ifdef R__HAS_VECCORE      
    else if(f1->IsVectorized())
       fitter->SetFunction(static_cast<const ROOT::Math::IParamMultiFunctionTempl<ROOT::Double_v> &>(ROOT::Math::WrappedMultiTF1Templ<ROOT::Double_v>(*f1)));
@@ -691,6 +709,22 @@ void ROOT::Fit::FitOptionsMake(EFitObjectType type, const char *option, Foption_
    TString opt = option;
    opt.ToUpper();
 
+   // execution policy (valid for both histograms and graphs)
+   // if (opt.Contains("MULTIPROC")) {
+   //    fitOption.ExecPolicy = ROOT::Fit::kMultiprocess;
+   //    opt.ReplaceAll("MULTIPROC","");
+   // }
+
+   if (opt.Contains("SERIAL")) {
+      fitOption.ExecPolicy = ROOT::Fit::ExecutionPolicy::kSerial;
+      opt.ReplaceAll("SERIAL","");
+   }
+
+   if (opt.Contains("MULTITHREAD")) {
+      fitOption.ExecPolicy = ROOT::Fit::ExecutionPolicy::kMultithread;
+      opt.ReplaceAll("MULTITHREAD","");
+   }
+
    // parse firt the specific options
    if (type == kHistogram) {
 
@@ -706,21 +740,6 @@ void ROOT::Fit::FitOptionsMake(EFitObjectType type, const char *option, Foption_
             opt.ReplaceAll("WIDTH","");
       }
 
-      // if (opt.Contains("MULTIPROC")) {
-      //    fitOption.ExecPolicy = ROOT::Fit::kMultiprocess;
-      //    opt.ReplaceAll("MULTIPROC","");
-      // }
-
-      if (opt.Contains("SERIAL")) {
-         fitOption.ExecPolicy = ROOT::Fit::ExecutionPolicy::kSerial;
-         opt.ReplaceAll("SERIAL","");
-      }
-
-      if (opt.Contains("MULTITHREAD")) {
-         fitOption.ExecPolicy = ROOT::Fit::ExecutionPolicy::kMultithread;
-         opt.ReplaceAll("MULTITHREAD","");
-      }
-
       if (opt.Contains("I"))  fitOption.Integral= 1;   // integral of function in the bin (no sense for graph)
       if (opt.Contains("WW")) fitOption.W1      = 2; //all bins have weight=1, even empty bins
    }
@@ -837,7 +856,9 @@ TFitResultPtr ROOT::Fit::UnBinFit(ROOT::Fit::UnBinData * data, TF1 * fitfunc, Fo
    // need to create a wrapper for an automatic  normalized TF1 ???
    if ( fitOption.Gradient ) {
       assert ( (int) dim == fitfunc->GetNdim() );
-      fitter->SetFunction(ROOT::Math::WrappedMultiTF1(*fitfunc) );
+      ROOT::Math::WrappedMultiTF1 wf(*fitfunc);
+      wf.SetUseFormulaGradient(HFit::HasFormulaGradient(fitfunc));
+      fitter->SetFunction(wf);
    }
    else
       fitter->SetFunction(static_cast<const ROOT::Math::IParamMultiFunction &>(ROOT::Math::WrappedMultiTF1(*fitfunc, dim) ) );
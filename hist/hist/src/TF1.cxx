@@ -1425,6 +1425,41 @@ Double_t TF1::EvalPar(const Double_t *x, const Double_t *params)
    return result;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluate the function at n points in a single call.
+///
+/// The array x contains the coordinates of the points one after the other
+/// (n * GetNdim() values) and the n function values are stored in result,
+/// which must be allocated by the caller. If params is null the current
+/// function parameters are used. The values are the same as the ones
+/// returned by EvalPar.
+///
+/// For functions defined by a formula expression the evaluation uses a
+/// batched function compiled by Cling (see TFormula::EvalN), whose loop over
+/// the points can be vectorized by the compiler. All other function types are
+/// evaluated point by point.
+
+void TF1::EvalN(Int_t n, const Double_t *x, Double_t *result, const Double_t *params)
+{
+   if (n <= 0) return;
+
+   if (fType == EFType::kFormula && fFormula && fFormula->GetNdim() == fNdim) {
+      fFormula->EvalN(n, x, result, params);
+      if (fNormalized && fNormIntegral != 0) {
+         for (Int_t i = 0; i < n; ++i)
+            result[i] /= fNormIntegral;
+      }
+      return;
+   }
+
+   for (Int_t i = 0; i < n; ++i) {
+      const Double_t *xi = x + i * fNdim;
+      if (fType == EFType::kInterpreted)
+         InitArgs(xi, (params) ? params : GetParameters());
+      result[i] = EvalPar(xi, params);
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Execute action corresponding to one event.
 ///
@@ -2929,7 +2964,6 @@ void TF1::Paint(Option_t *choptin)
 TH1   *TF1::DoCreateHistogram(Double_t xmin, Double_t  xmax, Bool_t recreate)
 {
    Int_t i;
-   Double_t xv[1];
 
    TH1 *histogram = 0;
 
@@ -2998,11 +3032,14 @@ TH1   *TF1::DoCreateHistogram(Double_t xmin, Double_t  xmax, Bool_t recreate)
    histogram->GetYaxis()->SetTitle(ytitle.Data());
    Double_t *parameters = GetParameters();
 
-   InitArgs(xv, parameters);
-   for (i = 1; i <= fNpx; i++) {
-      xv[0] = histogram->GetBinCenter(i);
-      histogram->SetBinContent(i, EvalPar(xv, parameters));
-   }
+   // evaluate the function at all the bin centers in one go
+   const Int_t ndim = TMath::Max(GetNdim(), 1);
+   std::vector<Double_t> xv(fNpx * ndim, 0.), values(fNpx);
+   for (i = 1; i <= fNpx; i++)
+      xv[(i - 1) * ndim] = histogram->GetBinCenter(i);
+   EvalN(fNpx, xv.data(), values.data(), parameters);
+   for (i = 1; i <= fNpx; i++)
+      histogram->SetBinContent(i, values[i - 1]);
 
    // Copy Function attributes to histogram attributes.
    histogram->SetBit(TH1::kNoStats);
@@ -3076,12 +3113,11 @@ void TF1::Save(Double_t xmin, Double_t xmax, Double_t, Double_t, Double_t, Doubl
       xmin = fXmin + 0.5 * dx;
       xmax = fXmax - 0.5 * dx;
    }
-   Double_t xv[1];
-   InitArgs(xv, parameters);
-   for (Int_t i = 0; i <= fNpx; i++) {
-      xv[0]    = xmin + dx * i;
-      fSave[i] = EvalPar(xv, parameters);
-   }
+   const Int_t ndim = TMath::Max(GetNdim(), 1);
+   std::vector<Double_t> xv((fNpx + 1) * ndim, 0.);
+   for (Int_t i = 0; i <= fNpx; i++)
+      xv[i * ndim] = xmin + dx * i;
+   EvalN(fNpx + 1, xv.data(), fSave.data(), parameters);
    fSave[fNpx + 1] = xmin;
    fSave[fNpx + 2] = xmax;
 }
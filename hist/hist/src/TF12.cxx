@@ -168,6 +168,17 @@ Double_t TF12::EvalPar(const Double_t *x, const Double_t *params)
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluate this function at n points, see TF1::EvalN.
+/// The points are projected on the mother TF2 one by one.
+
+void TF12::EvalN(Int_t n, const Double_t *x, Double_t *result, const Double_t *params)
+{
+   for (Int_t i = 0; i < n; ++i)
+      result[i] = EvalPar(x + i, params);
+}
+
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Save primitive as a C++ statement(s) on output stream out
 
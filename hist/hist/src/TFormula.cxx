@@ -24,6 +24,7 @@
 #include "TInterpreter.h"
 #include "TFormula.h"
 #include "TRegexp.h"
+#include <algorithm>
 #include <array>
 #include <cassert>
 #include <iostream>
@@ -691,6 +692,9 @@ void TFormula::Copy(TObject &obj) const
    }
 
    fnew.fFuncPtr = fFuncPtr;
+   fnew.fClingExpression = fClingExpression;
+   fnew.fBatchFuncPtr = fBatchFuncPtr.load();
+   fnew.fGradFuncPtr = fGradFuncPtr;
 
 }
 
@@ -705,6 +709,9 @@ void TFormula::Clear(Option_t * )
    fNumber = 0;
    fFormula = "";
    fClingName = "";
+   fClingExpression.clear();
+   fBatchFuncPtr = nullptr;
+   fGradFuncPtr = nullptr;
 
 
    if(fMethod) fMethod->Delete();
@@ -813,6 +820,132 @@ void TFormula::InputFormulaIntoCling()
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Compile in Cling the batched version of the formula used by EvalN.
+/// The generated function contains the loop over the points, so that the
+/// compiler can auto-vectorize it without requiring VecCore.
+/// The function pointer is cached in the global map of compiled functions,
+/// keyed on the expression and the number of dimensions. A failure is cached
+/// as well, in order not to try compiling the same expression again.
+///
+/// EvalN may be called concurrently (e.g. by the multi-threaded fits), so the
+/// function is compiled under the ROOT mutex and the pointer is published
+/// atomically, only once the function is fully built.
+
+Bool_t TFormula::PrepareBatchMethod()
+{
+   if (fBatchFuncPtr.load(std::memory_order_acquire)) return true;
+   if (fClingExpression.empty() || TestBit(TFormula::kLambda)) return false;
+
+   std::string batchKey = fClingExpression + TString::Format(" (batch %d)", fNdim).Data();
+
+   R__LOCKGUARD(gROOTMutex);
+   // another thread may have prepared it while we were waiting for the lock
+   if (fBatchFuncPtr.load(std::memory_order_acquire)) return true;
+   auto funcit = gClingFunctions.find(batchKey);
+   if (funcit != gClingFunctions.end()) {
+      auto batchFunc = (TInterpreter::CallFuncIFacePtr_t::Generic_t)funcit->second;
+      fBatchFuncPtr.store(batchFunc, std::memory_order_release);
+      return batchFunc != nullptr;
+   }
+
+   // make sure the interpreter is initialized
+   ROOT::GetROOT();
+   R__ASSERT(gCling);
+
+   auto hasher = gClingFunctions.hash_function();
+   TString batchName = TString::Format("%s__batch%zu", gNamePrefix.Data(), hasher(batchKey));
+   TString batchInput = TString::Format("#pragma cling optimize(2)\n"
+                                        "void %s(Int_t n, const Double_t *xs, Double_t *p, Double_t *out) {\n"
+                                        "   for (Int_t i = 0; i < n; ++i) {\n"
+                                        "      Double_t *x = const_cast<Double_t *>(xs) + i * %d;\n"
+                                        "      out[i] = %s ;\n"
+                                        "   }\n"
+                                        "}",
+                                        batchName.Data(), fNdim, fClingExpression.c_str());
+
+   TInterpreter::CallFuncIFacePtr_t::Generic_t batchFunc = nullptr;
+   if (gCling->Declare(batchInput)) {
+      TMethodCall method;
+      method.InitWithPrototype(batchName, "Int_t,const Double_t*,Double_t*,Double_t*");
+      if (method.IsValid()) {
+         CallFunc_t *callfunc = method.GetCallFunc();
+         if (gCling->CallFunc_IsValid(callfunc))
+            batchFunc = gCling->CallFunc_IFacePtr(callfunc).fGeneric;
+      }
+   }
+   if (!batchFunc)
+      Warning("PrepareBatchMethod", "Cannot compile batched version of %s - it will be evaluated point by point",
+              GetExpFormula().Data());
+
+   gClingFunctions.insert(std::make_pair(batchKey, (void *)batchFunc));
+   fBatchFuncPtr.store(batchFunc, std::memory_order_release);
+   return batchFunc != nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Generate with clad, the Cling automatic differentiation plugin, the function
+/// computing the gradient of the formula with respect to the parameters.
+///
+/// Once generated, GradientPar returns the exact derivatives. They are used
+/// in the fits only with the fit option "G", which generates them. As for the
+/// formula function, the gradient is cached in the global map of compiled
+/// functions and it is generated only once for each expression.
+/// Return false if the gradient cannot be generated: ROOT built without clad,
+/// formula without parameters, vectorized formula or lambda expression, or
+/// expressions that clad cannot differentiate.
+
+Bool_t TFormula::GenerateGradientPar()
+{
+#ifdef R__HAS_CLAD
+   if (fGradFuncPtr) return true;
+   if (fNpar <= 0 || fVectorized || !fReadyToExecute || fClingExpression.empty() || TestBit(TFormula::kLambda))
+      return false;
+
+   std::string gradKey = fClingExpression + " (gradient)";
+
+   R__LOCKGUARD(gROOTMutex);
+   auto funcit = gClingFunctions.find(gradKey);
+   if (funcit != gClingFunctions.end()) {
+      fGradFuncPtr = (TInterpreter::CallFuncIFacePtr_t::Generic_t)funcit->second;
+      return fGradFuncPtr != nullptr;
+   }
+
+   // the formula function needs to be declared in Cling to be differentiated
+   if (!fClingInitialized && fLazyInitialization) ReInitializeEvalMethod();
+   if (!fClingInitialized) return false;
+
+   static bool cladLoaded = false;
+   if (!cladLoaded) cladLoaded = gCling->Declare("#include <Math/CladDerivator.h>");
+
+   // clad generates the function clingName_grad(Double_t *x, Double_t *p, Double_t *result)
+   TString gradName = fClingName + "_grad";
+   TString gradInput = TString::Format("#pragma cling optimize(2)\n"
+                                       "#pragma clad ON\n"
+                                       "void %s_req() { clad::gradient(%s, \"p\"); }\n"
+                                       "#pragma clad OFF",
+                                       fClingName.Data(), fClingName.Data());
+
+   if (cladLoaded && gCling->Declare(gradInput)) {
+      TMethodCall method;
+      method.InitWithPrototype(gradName, "Double_t*,Double_t*,Double_t*");
+      if (method.IsValid()) {
+         CallFunc_t *callfunc = method.GetCallFunc();
+         if (gCling->CallFunc_IsValid(callfunc))
+            fGradFuncPtr = gCling->CallFunc_IFacePtr(callfunc).fGeneric;
+      }
+   }
+   if (!fGradFuncPtr)
+      Info("GenerateGradientPar", "Cannot generate the gradient of %s - numerical derivatives will be used",
+           GetExpFormula().Data());
+
+   gClingFunctions.insert(std::make_pair(gradKey, (void *)fGradFuncPtr));
+   return fGradFuncPtr != nullptr;
+#else
+   return false;
+#endif
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 ///    Fill structures with default variables, constants and function shortcuts
 
@@ -2269,6 +2402,11 @@ void TFormula::ProcessFormula(TString &formula)
          fClingInput = TString::Format("%s %s(%s){ return %s ; }", argType.Data(), fClingName.Data(),
                                        argumentsPrototype.Data(), inputFormula.c_str());
 
+         // the batched version used by EvalN and the gradient are compiled only when needed
+         fClingExpression = inputFormula;
+         fBatchFuncPtr = nullptr;
+         fGradFuncPtr = nullptr;
+
 
          // std::cout << "Input Formula " << inputFormula << " \t vec formula  :  " << inputFormulaVecFlag << std::endl;
          // std::cout << "Cling functions existing " << std::endl;
@@ -3101,6 +3239,66 @@ Double_t TFormula::EvalPar(const Double_t *x,const Double_t *params) const
 #endif
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluate the formula at `n` points in a single call.
+///
+/// `x` contains the coordinates of the points one after the other
+/// (`n * GetNdim()` values) and the `n` results are written in `result`.
+/// If `params` is null the stored parameter values are used.
+///
+/// The formula is evaluated with a batched function compiled by Cling on first
+/// use, where the loop over the points is part of the generated code and can
+/// therefore be vectorized by the compiler. Lambda expressions, and formulas
+/// for which the batched function cannot be built, are evaluated point by point.
+
+void TFormula::EvalN(Int_t n, const Double_t *x, Double_t *result, const Double_t *params) const
+{
+   if (n <= 0) return;
+
+   auto batchFunc = fBatchFuncPtr.load(std::memory_order_acquire);
+   if (fReadyToExecute && !batchFunc && !fClingExpression.empty()) {
+      // compiling the function is serialized and published atomically (see PrepareBatchMethod)
+      auto thisFormula = const_cast<TFormula *>(this);
+      if (thisFormula->PrepareBatchMethod())
+         batchFunc = fBatchFuncPtr.load(std::memory_order_acquire);
+   }
+
+   if (fReadyToExecute && batchFunc) {
+      Int_t npoints = n;
+      double *xs = const_cast<double *>(x);
+      double *pars = (params) ? const_cast<double *>(params) : const_cast<double *>(fClingParameters.data());
+      void *args[4] = {&npoints, &xs, &pars, &result};
+      (*batchFunc)(0, 4, args, nullptr);
+      return;
+   }
+
+   for (Int_t i = 0; i < n; ++i)
+      result[i] = EvalPar((x) ? x + i * fNdim : nullptr, params);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Compute the gradient of the formula with respect to the parameters at the
+/// point x, using the function created by GenerateGradientPar.
+///
+/// `result` must have room for GetNpar() values. If `params` is null the
+/// stored parameter values are used.
+/// Return false, without touching `result`, if the gradient function has not
+/// been generated.
+
+Bool_t TFormula::GradientPar(const Double_t *x, Double_t *result, const Double_t *params) const
+{
+   if (!fGradFuncPtr) return false;
+
+   // the generated function accumulates the derivatives in the result
+   std::fill(result, result + fNpar, 0.);
+
+   double *vars = (x) ? const_cast<double *>(x) : const_cast<double *>(fClingVariables.data());
+   double *pars = (params) ? const_cast<double *>(params) : const_cast<double *>(fClingParameters.data());
+   void *args[3] = {&vars, &pars, &result};
+   (*fGradFuncPtr)(0, 3, args, nullptr);
+   return true;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 #ifdef R__HAS_VECCORE
 // ROOT::Double_v TFormula::Eval(ROOT::Double_v x, ROOT::Double_v y, ROOT::Double_v z, ROOT::Double_v t) const
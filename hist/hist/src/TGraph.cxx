@@ -35,6 +35,7 @@
 #include <stdlib.h>
 #include <string>
 #include <cassert>
+#include <vector>
 
 #include "HFitInterface.h"
 #include "Fit/DataRange.h"
@@ -553,8 +554,18 @@ void TGraph::Apply(TF1 *f)
 {
    if (fHistogram) SetBit(kResetHisto);
 
-   for (Int_t i = 0; i < fNpoints; i++) {
-      fY[i] = f->Eval(fX[i], fY[i]);
+   // evaluate all the points at once; for a 2-dimensional function the
+   // current y values are passed as second coordinate
+   Int_t ndim = f->GetNdim();
+   if (ndim <= 1) {
+      f->EvalN(fNpoints, fX, fY);
+   } else {
+      std::vector<Double_t> xx(fNpoints * ndim, 0.);
+      for (Int_t i = 0; i < fNpoints; i++) {
+         xx[i * ndim] = fX[i];
+         xx[i * ndim + 1] = fY[i];
+      }
+      f->EvalN(fNpoints, xx.data(), fY);
    }
    if (gPad) gPad->Modified();
 }
@@ -859,6 +870,11 @@ void TGraph::DrawPanel()
 ///   If the points are sorted in X a binary search is used (significantly faster)
 ///   One needs to set the bit  TGraph::SetBit(TGraph::kIsSortedX) before calling
 ///   TGraph::Eval to indicate that the graph is sorted in X.
+///
+///   For evaluating the graph many times, e.g. in the event loop or in a
+///   RDataFrame Define, use a TGraphInterpolator: it sorts the points only once,
+///   exploits equidistant abscissas, keeps the spline for option "S" and is
+///   thread safe.
 
 Double_t TGraph::Eval(Double_t x, TSpline *spline, Option_t *option) const
 {
@@ -877,6 +893,11 @@ Double_t TGraph::Eval(Double_t x, TSpline *spline, Option_t *option) const
       // create a TSpline every time when using option "s" and no spline pointer is given
       if (opt.Contains("s")) {
 
+         if (TestBit(TGraph::kIsSortedX)) {
+            TSpline3 s("", fX, fY, fNpoints);
+            return s.Eval(x);
+         }
+
          // points must be sorted before using a TSpline
          std::vector<Double_t> xsort(fNpoints);
          std::vector<Double_t> ysort(fNpoints);
@@ -25,6 +25,7 @@
 #include "TSystem.h"
 #include <stdlib.h>
 #include <cassert>
+#include <vector>
 
 #include "HFitInterface.h"
 #include "Fit/DataRange.h"
@@ -1169,18 +1170,33 @@ TH2D *TGraph2D::GetHistogram(Option_t *option)
 
    Double_t x, y, z;
 
-   for (Int_t ix = 1; ix <= fNpx; ix++) {
-      x  = hxmin + (ix - 0.5) * dx;
-      for (Int_t iy = 1; iy <= fNpy; iy++) {
-         y  = hymin + (iy - 0.5) * dy;
-         // do interpolation
-         if (oldInterp)
+   if (oldInterp) {
+      for (Int_t ix = 1; ix <= fNpx; ix++) {
+         x  = hxmin + (ix - 0.5) * dx;
+         for (Int_t iy = 1; iy <= fNpy; iy++) {
+            y  = hymin + (iy - 0.5) * dy;
+            // do interpolation
             z  = ((TGraphDelaunay*)fDelaunay)->ComputeZ(x, y);
-         else
-            z  = ((TGraphDelaunay2D*)fDelaunay)->ComputeZ(x, y);
 
-         fHistogram->Fill(x, y, z);
+            fHistogram->Fill(x, y, z);
+         }
+      }
+   } else {
+      // interpolate all the bin centres in one go (in parallel if the implicit
+      // multi-threading is enabled) and fill the histogram afterwards
+      const Int_t nbins = fNpx * fNpy;
+      std::vector<Double_t> xv(nbins), yv(nbins), zv(nbins);
+      for (Int_t ix = 1; ix <= fNpx; ix++) {
+         x  = hxmin + (ix - 0.5) * dx;
+         for (Int_t iy = 1; iy <= fNpy; iy++) {
+            const Int_t ibin = (ix - 1) * fNpy + iy - 1;
+            xv[ibin] = x;
+            yv[ibin] = hymin + (iy - 0.5) * dy;
+         }
       }
+      ((TGraphDelaunay2D*)fDelaunay)->ComputeZN(nbins, xv.data(), yv.data(), zv.data());
+      for (Int_t ibin = 0; ibin < nbins; ibin++)
+         fHistogram->Fill(xv[ibin], yv[ibin], zv[ibin]);
    }
 
 
@@ -0,0 +1,203 @@
+// @(#)root/hist:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2019, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "TGraphInterpolator.h"
+#include "TGraph.h"
+#include "TSpline.h"
+#include "TString.h"
+#include "TMath.h"
+
+#include <algorithm>
+#include <numeric>
+
+ClassImp(TGraphInterpolator);
+
+/** \class TGraphInterpolator
+    \ingroup Hist
+Cached interpolation of the points of a TGraph.
+
+TGraph::Eval has to look for the neighbours of x at every call: with a linear
+scan of all the points, or with a binary search if the graph is flagged with
+TGraph::kIsSortedX, and with option "S" it sorts the points and builds a new
+TSpline3 each time. A TGraphInterpolator takes a snapshot of the points once,
+sorted in increasing x, and then returns the same values as TGraph::Eval:
+
+  - by default a linear interpolation between the two points around x (or a
+    linear extrapolation using the first or last two points);
+  - with option "S" the value of a TSpline3 built from the sorted points.
+
+If the abscissas are equidistant the neighbours are found directly from the
+grid index, otherwise with a binary search. EvalN evaluates many abscissas in
+one go, reusing the last interval found when the inputs are close to each
+other (e.g. sorted).
+
+The object is not modified after construction, so it can be shared between
+threads, for example in a RDataFrame Define:
+~~~ {.cpp}
+   TGraphInterpolator interp(*graph);
+   auto df2 = df.Define("w", [&interp](double x) { return interp.Eval(x); }, {"x"});
+~~~
+Changes made to the graph after constructing the interpolator are not seen
+by it.
+*/
+
+////////////////////////////////////////////////////////////////////////////////
+/// Build the interpolator from the current points of the graph g.
+/// Option "S" selects the cubic spline interpolation.
+
+TGraphInterpolator::TGraphInterpolator(const TGraph &g, Option_t *option)
+   : fUniform(kFALSE), fInvDelta(0)
+{
+   Init(g.GetN(), g.GetX(), g.GetY(), option);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Build the interpolator from n points given in arbitrary order.
+/// Option "S" selects the cubic spline interpolation.
+
+TGraphInterpolator::TGraphInterpolator(Int_t n, const Double_t *x, const Double_t *y, Option_t *option)
+   : fUniform(kFALSE), fInvDelta(0)
+{
+   Init(n, x, y, option);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Destructor.
+
+TGraphInterpolator::~TGraphInterpolator()
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Copy the points sorted in increasing x (keeping the original order of points
+/// with the same abscissa) and check whether they lie on a uniform grid.
+
+void TGraphInterpolator::Init(Int_t n, const Double_t *x, const Double_t *y, Option_t *option)
+{
+   if (n <= 0 || !x || !y)
+      return;
+
+   fX.resize(n);
+   fY.resize(n);
+   if (std::is_sorted(x, x + n)) {
+      std::copy(x, x + n, fX.begin());
+      std::copy(y, y + n, fY.begin());
+   } else {
+      std::vector<Int_t> index(n);
+      std::iota(index.begin(), index.end(), 0);
+      std::stable_sort(index.begin(), index.end(), [x](Int_t i, Int_t j) { return x[i] < x[j]; });
+      for (Int_t i = 0; i < n; ++i) {
+         fX[i] = x[index[i]];
+         fY[i] = y[index[i]];
+      }
+   }
+
+   if (n > 2) {
+      const Double_t delta = (fX[n - 1] - fX[0]) / (n - 1);
+      fUniform = delta > 0;
+      for (Int_t i = 1; fUniform && i < n - 1; ++i)
+         fUniform = TMath::Abs(fX[i] - (fX[0] + i * delta)) <= 1.E-6 * delta;
+      if (fUniform)
+         fInvDelta = 1. / delta;
+   }
+
+   TString opt = option;
+   opt.ToLower();
+   if (n > 1 && opt.Contains("s"))
+      fSpline.reset(new TSpline3("", fX.data(), fY.data(), n));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the index of the first point with abscissa equal to x or, if there
+/// is none, of the last point with abscissa smaller than x (-1 if x is before
+/// the first point), as TMath::BinarySearch does.
+
+Int_t TGraphInterpolator::FindLow(Double_t x) const
+{
+   const Int_t n = fX.size();
+   if (fUniform) {
+      if (!(x >= fX[0]))
+         return -1;
+      if (x >= fX[n - 1])
+         return n - 1;
+      // guess from the grid, correct for the rounding errors
+      Int_t low = TMath::Min(Int_t((x - fX[0]) * fInvDelta), n - 2);
+      while (low > 0 && fX[low] > x)
+         --low;
+      while (low < n - 2 && fX[low + 1] <= x)
+         ++low;
+      return low;
+   }
+   auto it = std::lower_bound(fX.begin(), fX.end(), x);
+   if (it != fX.end() && *it == x)
+      return it - fX.begin();
+   return (it - fX.begin()) - 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Linear interpolation at x given the index low returned by FindLow.
+/// Same algorithm as TGraph::Eval for a graph sorted in x.
+
+Double_t TGraphInterpolator::Interpolate(Double_t x, Int_t low) const
+{
+   const Int_t n = fX.size();
+   if (low == -1)
+      low = 0; // use the first two points for the extrapolation
+   if (fX[low] == x)
+      return fY[low];
+   if (low == n - 1)
+      low--; // use the last two points for the extrapolation
+   const Int_t up = low + 1;
+   if (fX[low] == fX[up])
+      return fY[low];
+   return fY[up] + (x - fX[up]) * (fY[low] - fY[up]) / (fX[low] - fX[up]);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Interpolate the points at x. It returns the same value as TGraph::Eval(x)
+/// (or TGraph::Eval(x, 0, "S") if the interpolator was built with option "S").
+
+Double_t TGraphInterpolator::Eval(Double_t x) const
+{
+   const Int_t n = fX.size();
+   if (n == 0)
+      return 0;
+   if (n == 1)
+      return fY[0];
+   if (fSpline)
+      return fSpline->Eval(x);
+   return Interpolate(x, FindLow(x));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Interpolate the points at the n abscissas x and store the values in result.
+/// The interval found for an abscissa is reused for the next one when it still
+/// contains it, so evaluating sorted or clustered abscissas needs no search.
+
+void TGraphInterpolator::EvalN(Int_t n, const Double_t *x, Double_t *result) const
+{
+   const Int_t np = fX.size();
+   if (np <= 1) {
+      std::fill(result, result + n, np == 0 ? 0. : fY[0]);
+      return;
+   }
+   if (fSpline) {
+      fSpline->EvalN(n, x, result);
+      return;
+   }
+   Int_t low = -1;
+   for (Int_t i = 0; i < n; ++i) {
+      const Double_t xi = x[i];
+      // FindLow returns low for any abscissa strictly inside (fX[low], fX[low+1])
+      if (!(low >= 0 && low < np - 1 && fX[low] < xi && xi < fX[low + 1]))
+         low = FindLow(xi);
+      result[i] = Interpolate(xi, low);
+   }
+}
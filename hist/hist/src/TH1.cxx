@@ -15,6 +15,7 @@
 #include <ctype.h>
 #include <sstream>
 #include <cmath>
+#include <vector>
 
 #include "Riostream.h"
 #include "TROOT.h"
@@ -748,7 +749,7 @@ void TH1::Build()
 
    UseCurrentStyle();
 
-   if (TH1::AddDirectoryStatus()) {
+   if (TH1::AddDirectoryStatus() && TDirectory::AddDirectoryThisThreadStatus()) {
       fDirectory = gDirectory;
       if (fDirectory) {
          fFunctions->UseRWLock();
@@ -808,22 +809,63 @@ Bool_t TH1::Add(TF1 *f1, Double_t c1, Option_t *option)
    Double_t xx[3];
    Double_t *params = 0;
    f1->InitArgs(xx,params);
+
+   // without the integral option the function is evaluated for a full row of
+   // bins at once with TF1::EvalN
+   const Int_t ndimf = TMath::Max(f1->GetNdim(), 1);
+   std::vector<Int_t> rowBins;
+   std::vector<Double_t> rowX, rowValues;
+   if (!integral) {
+      rowBins.reserve(ncellsx);
+      rowX.reserve(ncellsx * ndimf);
+      rowValues.reserve(ncellsx);
+   }
+
    for (binz = 0; binz < ncellsz; ++binz) {
       xx[2] = fZaxis.GetBinCenter(binz);
       for (biny = 0; biny < ncellsy; ++biny) {
          xx[1] = fYaxis.GetBinCenter(biny);
+         if (integral) {
+            for (binx = 0; binx < ncellsx; ++binx) {
+               xx[0] = fXaxis.GetBinCenter(binx);
+               if (!f1->IsInside(xx)) continue;
+               TF1::RejectPoint(kFALSE);
+               bin = binx + ncellsx * (biny + ncellsy * binz);
+               cu = c1*f1->Integral(fXaxis.GetBinLowEdge(binx), fXaxis.GetBinUpEdge(binx), 0.) / fXaxis.GetBinWidth(binx);
+               if (TF1::RejectedPoint()) continue;
+               AddBinContent(bin,cu);
+            }
+            continue;
+         }
+
+         rowBins.clear();
+         rowX.clear();
          for (binx = 0; binx < ncellsx; ++binx) {
             xx[0] = fXaxis.GetBinCenter(binx);
             if (!f1->IsInside(xx)) continue;
-            TF1::RejectPoint(kFALSE);
-            bin = binx + ncellsx * (biny + ncellsy * binz);
-            if (integral) {
-               cu = c1*f1->Integral(fXaxis.GetBinLowEdge(binx), fXaxis.GetBinUpEdge(binx), 0.) / fXaxis.GetBinWidth(binx);
-            } else {
-               cu  = c1*f1->EvalPar(xx);
+            rowBins.push_back(binx);
+            for (Int_t idim = 0; idim < ndimf; ++idim)
+               rowX.push_back(idim < 3 ? xx[idim] : 0.);
+         }
+         Int_t npoints = rowBins.size();
+         if (npoints == 0) continue;
+         rowValues.resize(npoints);
+         TF1::RejectPoint(kFALSE);
+         f1->EvalN(npoints, rowX.data(), rowValues.data());
+         // if the function rejected some points evaluate the row again point
+         // by point to find out which ones
+         Bool_t rejected = TF1::RejectedPoint();
+         if (rejected) f1->InitArgs(xx,params);
+         for (Int_t ip = 0; ip < npoints; ++ip) {
+            binx = rowBins[ip];
+            if (rejected) {
+               xx[0] = fXaxis.GetBinCenter(binx);
+               TF1::RejectPoint(kFALSE);
+               rowValues[ip] = f1->EvalPar(xx);
+               if (TF1::RejectedPoint()) continue;
             }
-            if (TF1::RejectedPoint()) continue;
-            AddBinContent(bin,cu);
+            bin = binx + ncellsx * (biny + ncellsy * binz);
+            AddBinContent(bin, c1*rowValues[ip]);
          }
       }
    }
@@ -2643,7 +2685,7 @@ void TH1::Copy(TObject &obj) const
    // will be added to gDirectory independently of the fDirectory stored.
    // and if the AddDirectoryStatus() is false it will not be added to
    // any directory (fDirectory = 0)
-   if (fgAddDirectory && gDirectory) {
+   if (fgAddDirectory && TDirectory::AddDirectoryThisThreadStatus() && gDirectory) {
       gDirectory->Append(&obj);
       ((TH1&)obj).fFunctions->UseRWLock();
       ((TH1&)obj).fDirectory = gDirectory;
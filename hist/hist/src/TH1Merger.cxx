@@ -8,6 +8,13 @@
 #include "TError.h"
 #include "THashList.h"
 #include "TClass.h"
+#include "TROOT.h"
+
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#endif
+
+#include <algorithm>
 #include <iostream>
 #include <limits>
 #include <utility>
@@ -741,44 +748,113 @@ Bool_t TH1Merger::BufferMerge()
    return kFALSE; 
 }
 
-Bool_t TH1Merger::SameAxesMerge() { 
+namespace {
 
+// number of inputs summed sequentially at the leaves of the pairwise reduction tree
+constexpr size_t kPairwiseLeafSize = 8;
 
-   Double_t stats[TH1::kNstat], totstats[TH1::kNstat];
-   for (Int_t i=0;i<TH1::kNstat;i++) {
-      totstats[i] = stats[i] = 0;
+// depth of the pairwise reduction tree for n inputs
+size_t PairwiseDepth(size_t n)
+{
+   size_t depth = 0;
+   while (n > kPairwiseLeafSize) {
+      n = (n + 1) / 2;
+      ++depth;
    }
-   fH0->GetStats(totstats);
-   Double_t nentries = fH0->GetEntries();
-   
-   TIter next(&fInputList); 
-   while (TH1* hist=(TH1*)next()) {
-      // process only if the histogram has limits; otherwise it was processed before
-      // in the case of an existing buffer (see if statement just before)
+   return depth;
+}
 
-      if (gDebug)
-         Info("TH1Merger::SameAxesMerge","Merging histogram %s into %s",hist->GetName(), fH0->GetName() );
+// Sum the values of the inputs [lo, hi) in the range [first, first + n) using a pairwise
+// reduction tree and store the result in out. addInput(k, first, n, out) adds the values
+// of the input k to out. scratch must have space for n * PairwiseDepth(hi - lo) values.
+template <class AddInput>
+void PairwiseSum(const AddInput &addInput, size_t lo, size_t hi, Int_t first, Int_t n, Double_t *out,
+                 Double_t *scratch)
+{
+   if (hi - lo <= kPairwiseLeafSize) {
+      std::fill(out, out + n, 0.);
+      for (size_t k = lo; k < hi; ++k)
+         addInput(k, first, n, out);
+      return;
+   }
+   const size_t mid = lo + (hi - lo) / 2;
+   PairwiseSum(addInput, lo, mid, first, n, out, scratch);
+   PairwiseSum(addInput, mid, hi, first, n, scratch, scratch + n);
+   for (Int_t i = 0; i < n; ++i)
+      out[i] += scratch[i];
+}
 
-      // skip empty histograms
-      if (hist->IsEmpty()) continue; 
+// Return true if the TArrayType base of h0 and of all the hists holds their bin contents, i.e. it
+// has one element per cell. This is not the case for example for TH1K, whose array stores the filled values
+template <class TArrayType>
+bool HaveBinArrays(const TH1 *h0, const std::vector<TH1 *> &hists)
+{
+   auto isBinArray = [](const TH1 *h) {
+      auto array = dynamic_cast<const TArrayType *>(h);
+      return array && array->fN == h->GetNcells();
+   };
+   return isBinArray(h0) && std::all_of(hists.begin(), hists.end(), isBinArray);
+}
 
-      // import statistics
-      hist->GetStats(stats);
-      for (Int_t i=0; i<TH1::kNstat; i++)
-         totstats[i] += stats[i];
-      nentries += hist->GetEntries();
+} // namespace
 
-         //Int_t nx = hist->GetXaxis()->GetNbins();
+/// Merge histograms with the same axes.
+/// The statistics and, when all the histograms are of the same floating point type,
+/// the bin contents are summed with a pairwise reduction over the input histograms.
+Bool_t TH1Merger::SameAxesMerge() { 
+
+   // the empty histograms are skipped
+   std::vector<TH1 *> hists;
+   hists.reserve(fInputList.GetSize());
+   TIter next(&fInputList); 
+   while (TH1* hist=(TH1*)next()) {
+      if (gDebug)
+         Info("TH1Merger::SameAxesMerge","Merging histogram %s into %s",hist->GetName(), fH0->GetName() );
+      if (!hist->IsEmpty()) hists.push_back(hist);
+   }
+   if (hists.empty()) return kTRUE;
+
+   // sum the statistics (and the number of entries, stored in the last element)
+   constexpr Int_t nstat = TH1::kNstat + 1;
+   std::vector<Double_t> inputStats(hists.size() * nstat);
+   for (size_t k = 0; k < hists.size(); ++k) {
+      hists[k]->GetStats(&inputStats[k * nstat]);
+      inputStats[k * nstat + TH1::kNstat] = hists[k]->GetEntries();
+   }
+   Double_t totstats[nstat];
+   std::vector<Double_t> statScratch(nstat * PairwiseDepth(hists.size()));
+   PairwiseSum([&](size_t k, Int_t first, Int_t n, Double_t *out) {
+                  for (Int_t i = 0; i < n; ++i) out[i] += inputStats[k * nstat + first + i];
+               },
+               0, hists.size(), 0, nstat, totstats, statScratch.data());
+
+   Double_t stats[TH1::kNstat];
+   for (Int_t i = 0; i < TH1::kNstat; i++) stats[i] = 0;
+   fH0->GetStats(stats);
+   for (Int_t i = 0; i < TH1::kNstat; i++) totstats[i] += stats[i];
+   Double_t nentries = fH0->GetEntries() + totstats[TH1::kNstat];
+
+   // when all the histograms have the same type and store their bin contents in a floating point
+   // array, the arrays are summed directly.
+   // This is not done for the integer types since AddBinContent saturates their content
+   Bool_t sameType = std::all_of(hists.begin(), hists.end(), [&](const TH1 *h) { return h->IsA() == fH0->IsA(); });
+   if (sameType && HaveBinArrays<TArrayD>(fH0, hists)) {
+      SameAxesMergeArrays<Double_t, TArrayD>(hists);
+   } else if (sameType && HaveBinArrays<TArrayF>(fH0, hists)) {
+      SameAxesMergeArrays<Float_t, TArrayF>(hists);
+   } else {
+      for (TH1 *hist : hists) {
          // loop on bins of the histogram and do the merge
-      for (Int_t ibin = 0; ibin < hist->fNcells; ibin++) {
+         for (Int_t ibin = 0; ibin < hist->fNcells; ibin++) {
 
-         Double_t cu = hist->RetrieveBinContent(ibin);
-         Double_t e1sq = TMath::Abs(cu);
-         if (fH0->fSumw2.fN) e1sq= hist->GetBinErrorSqUnchecked(ibin);
+            Double_t cu = hist->RetrieveBinContent(ibin);
+            Double_t e1sq = TMath::Abs(cu);
+            if (fH0->fSumw2.fN) e1sq= hist->GetBinErrorSqUnchecked(ibin);
 
-         fH0->AddBinContent(ibin,cu);
-         if (fH0->fSumw2.fN) fH0->fSumw2.fArray[ibin] += e1sq;
+            fH0->AddBinContent(ibin,cu);
+            if (fH0->fSumw2.fN) fH0->fSumw2.fArray[ibin] += e1sq;
 
+         }
       }
    }
    //copy merged stats
@@ -788,6 +864,64 @@ Bool_t TH1Merger::SameAxesMerge() {
    return kTRUE;
 }
 
+/// Sum the bin contents and the sum of the weight squares of hists into fH0,
+/// working directly on the arrays of bins of type T (histograms deriving from TArrayType).
+/// The bins are processed in ranges, in parallel when the implicit multi-threading is enabled,
+/// and in each range the inputs are summed with a pairwise reduction
+template <class T, class TArrayType>
+void TH1Merger::SameAxesMergeArrays(const std::vector<TH1 *> &hists)
+{
+   const size_t nhists = hists.size();
+   const Int_t ncells = fH0->fNcells;
+   T *dest = dynamic_cast<TArrayType *>(fH0)->fArray;
+   Double_t *destSumw2 = (fH0->fSumw2.fN) ? fH0->fSumw2.fArray : nullptr;
+
+   std::vector<const T *> contents(nhists);
+   std::vector<const Double_t *> sumw2(nhists);
+   for (size_t k = 0; k < nhists; ++k) {
+      contents[k] = dynamic_cast<TArrayType *>(hists[k])->fArray;
+      sumw2[k] = (hists[k]->fSumw2.fN) ? hists[k]->fSumw2.fArray : nullptr;
+   }
+
+   auto addContent = [&](size_t k, Int_t first, Int_t n, Double_t *out) {
+      const T *src = contents[k] + first;
+      for (Int_t i = 0; i < n; ++i) out[i] += src[i];
+   };
+   // for the histograms without sum of weight squares use the bin content (as GetBinErrorSqUnchecked)
+   auto addSumw2 = [&](size_t k, Int_t first, Int_t n, Double_t *out) {
+      if (!sumw2[k]) return addContent(k, first, n, out);
+      const Double_t *src = sumw2[k] + first;
+      for (Int_t i = 0; i < n; ++i) out[i] += src[i];
+   };
+
+   const size_t depth = PairwiseDepth(nhists);
+   auto mergeRange = [&](Int_t first, Int_t last) {
+      const Int_t n = last - first;
+      std::vector<Double_t> buffer(n * (depth + 1));
+      Double_t *sum = buffer.data();
+      PairwiseSum(addContent, 0, nhists, first, n, sum, sum + n);
+      for (Int_t i = 0; i < n; ++i) dest[first + i] += sum[i];
+      if (destSumw2) {
+         PairwiseSum(addSumw2, 0, nhists, first, n, sum, sum + n);
+         for (Int_t i = 0; i < n; ++i) destSumw2[first + i] += sum[i];
+      }
+   };
+
+   const Int_t chunkSize = 4096;
+#ifdef R__USE_IMT
+   if (ROOT::IsImplicitMTEnabled() && ncells > chunkSize) {
+      const UInt_t nChunks = (ncells + chunkSize - 1) / chunkSize;
+      ROOT::TThreadExecutor pool;
+      pool.Foreach([&](UInt_t chunk) {
+         mergeRange(chunk * chunkSize, std::min<Int_t>(ncells, (chunk + 1) * chunkSize));
+      }, ROOT::TSeq<UInt_t>(0, nChunks));
+      return;
+   }
+#endif
+   for (Int_t first = 0; first < ncells; first += chunkSize)
+      mergeRange(first, std::min<Int_t>(ncells, first + chunkSize));
+}
+
 
 /**
    Merged histogram when axis can be different. 
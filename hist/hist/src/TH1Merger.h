@@ -14,6 +14,8 @@
 #include "TH1.h"
 #include "TList.h"
 
+#include <vector>
+
 class TH1Merger {
 
 public:
@@ -97,6 +99,9 @@ private:
 
    Bool_t SameAxesMerge();
 
+   template <class T, class TArrayType>
+   void SameAxesMergeArrays(const std::vector<TH1 *> &hists);
+
    Bool_t DifferentAxesMerge();
 
    Bool_t LabelMerge();
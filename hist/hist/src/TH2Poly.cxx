@@ -16,6 +16,15 @@
 #include "TClass.h"
 #include "TList.h"
 #include "TMath.h"
+#include "TROOT.h"
+
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#endif
+
+#include <algorithm>
+#include <mutex>
+#include <vector>
 
 ClassImp(TH2Poly);
 
@@ -134,8 +143,158 @@ filling, it also adds a constant time delay into the code. When `Fill()`
 is to be called many times, it is more efficient to divide the histogram into
 a large number cells. However, if the histogram is to be filled only a few
 times, it is better to divide into a small number of cells.
+
+## Bin Lookup
+`FindBin()` and `Fill()` do not loop over the bins of a partition cell but
+use a spatial index, the internal class `TH2PolyBinTree`, which is built from
+the bins the first time it is needed and discarded whenever a bin is added or
+the partition is changed. It is a quadtree over the bounding boxes of the
+bins that adapts its depth to the local bin density, so histograms with many
+small bins in some regions and few large ones elsewhere are filled
+efficiently independent of the number of partition cells. `FillN()` looks up
+the bins of all points in parallel if implicit multi-threading is enabled
+(see `ROOT::EnableImplicitMT()`), and then fills them in order.
 */
 
+/** \class TH2PolyBinTree
+TH2PolyBinTree is used internally by TH2Poly to find the bin containing a
+point. It is a quadtree over the bounding boxes of the bins: a node with more
+than kMaxLeafSize bins is split into four quadrants as long as this separates
+the bins, up to a depth of kMaxDepth. The leaves store the bounding boxes and,
+for TGraph bins, the vertices of the polygons contiguously, so that most
+candidate bins are rejected without touching the bin objects. Once built the
+tree is only read, so lookups can be done concurrently.
+*/
+
+class TH2PolyBinTree {
+public:
+   TH2PolyBinTree(TList *bins, Double_t xmin, Double_t xmax, Double_t ymin, Double_t ymax);
+   TH2PolyBin *FindBin(Double_t x, Double_t y) const;
+
+private:
+   enum { kMaxLeafSize = 8, kMaxDepth = 16 };
+
+   struct Entry {
+      Double_t fXmin, fXmax, fYmin, fYmax; // bounding box of the bin
+      Double_t *fX, *fY;                   // vertices of a TGraph bin
+      Int_t fN;                            // number of vertices, 0 if the bin is not a TGraph
+      TH2PolyBin *fBin;                    // the bin
+   };
+   struct Node {
+      Double_t fXmid, fYmid; // split point of the node
+      Int_t fChild;          // index of the first of the four children, -1 for a leaf
+      Int_t fBegin, fEnd;    // range of a leaf's entries in fEntries
+   };
+
+   void Build(Int_t node, std::vector<Entry> &entries, Double_t xmin, Double_t xmax,
+              Double_t ymin, Double_t ymax, Int_t depth);
+
+   Double_t fXmin, fXmax, fYmin, fYmax; // range of the histogram
+   std::vector<Node> fNodes;            // nodes of the tree, the root is the first one
+   std::vector<Entry> fEntries;         // entries of all leaves
+};
+
+////////////////////////////////////////////////////////////////////////////////
+/// Build the tree for the bins in the list "bins" (which can be 0) that
+/// overlap the histogram range [xmin, xmax] x [ymin, ymax].
+
+TH2PolyBinTree::TH2PolyBinTree(TList *bins, Double_t xmin, Double_t xmax, Double_t ymin, Double_t ymax)
+   : fXmin(xmin), fXmax(xmax), fYmin(ymin), fYmax(ymax)
+{
+   std::vector<Entry> entries;
+   if (bins) {
+      entries.reserve(bins->GetSize());
+      TIter next(bins);
+      TObject *obj;
+      while ((obj = next())) {
+         TH2PolyBin *bin = (TH2PolyBin*) obj;
+         Entry entry{bin->GetXMin(), bin->GetXMax(), bin->GetYMin(), bin->GetYMax(), 0, 0, 0, bin};
+         if (entry.fXmax < xmin || entry.fXmin > xmax || entry.fYmax < ymin || entry.fYmin > ymax)
+            continue;
+         TObject *poly = bin->GetPolygon();
+         if (poly->IsA() == TGraph::Class()) {
+            TGraph *g = (TGraph*) poly;
+            entry.fX = g->GetX();
+            entry.fY = g->GetY();
+            entry.fN = g->GetN();
+         }
+         entries.push_back(entry);
+      }
+   }
+   fEntries.reserve(entries.size());
+   fNodes.resize(1);
+   Build(0, entries, xmin, xmax, ymin, ymax, 0);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Make "node", covering [xmin, xmax] x [ymin, ymax], a leaf holding
+/// "entries" or split it and recursively build its children.
+/// The children are ordered (low x, low y), (high x, low y), (low x, high y),
+/// (high x, high y); points on the split lines belong to the high side.
+
+void TH2PolyBinTree::Build(Int_t node, std::vector<Entry> &entries, Double_t xmin, Double_t xmax,
+                           Double_t ymin, Double_t ymax, Int_t depth)
+{
+   if (entries.size() > kMaxLeafSize && depth < kMaxDepth) {
+      const Double_t xmid = 0.5 * (xmin + xmax);
+      const Double_t ymid = 0.5 * (ymin + ymax);
+      std::vector<Entry> quadrants[4];
+      for (const Entry &entry: entries) {
+         const bool low[2] = {entry.fXmin < xmid, entry.fYmin < ymid};
+         const bool high[2] = {entry.fXmax >= xmid, entry.fYmax >= ymid};
+         for (Int_t q = 0; q < 4; ++q) {
+            if ((q & 1 ? high[0] : low[0]) && (q & 2 ? high[1] : low[1]))
+               quadrants[q].push_back(entry);
+         }
+      }
+      size_t maxSize = 0;
+      for (const auto &quadrant: quadrants)
+         maxSize = std::max(maxSize, quadrant.size());
+      // Splitting only pays off if it separates the bins.
+      if (maxSize < entries.size()) {
+         const Int_t child = fNodes.size();
+         fNodes.resize(child + 4);
+         fNodes[node].fXmid = xmid;
+         fNodes[node].fYmid = ymid;
+         fNodes[node].fChild = child;
+         std::vector<Entry>().swap(entries);
+         Build(child, quadrants[0], xmin, xmid, ymin, ymid, depth + 1);
+         Build(child + 1, quadrants[1], xmid, xmax, ymin, ymid, depth + 1);
+         Build(child + 2, quadrants[2], xmin, xmid, ymid, ymax, depth + 1);
+         Build(child + 3, quadrants[3], xmid, xmax, ymid, ymax, depth + 1);
+         return;
+      }
+   }
+
+   fNodes[node].fChild = -1;
+   fNodes[node].fBegin = fEntries.size();
+   fEntries.insert(fEntries.end(), entries.begin(), entries.end());
+   fNodes[node].fEnd = fEntries.size();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the first bin (in the order they were added) containing (x,y), or 0
+/// if there is none or if (x,y) is outside of the histogram range.
+
+TH2PolyBin *TH2PolyBinTree::FindBin(Double_t x, Double_t y) const
+{
+   if (x <= fXmin || x > fXmax || y <= fYmin || y > fYmax)
+      return 0;
+
+   Int_t node = 0;
+   while (fNodes[node].fChild >= 0)
+      node = fNodes[node].fChild + (x >= fNodes[node].fXmid) + 2 * (y >= fNodes[node].fYmid);
+
+   for (Int_t i = fNodes[node].fBegin; i < fNodes[node].fEnd; ++i) {
+      const Entry &entry = fEntries[i];
+      if (x < entry.fXmin || x > entry.fXmax || y < entry.fYmin || y > entry.fYmax)
+         continue;
+      if (entry.fN ? TMath::IsInside(x, y, entry.fN, entry.fX, entry.fY) : entry.fBin->IsInside(x, y))
+         return entry.fBin;
+   }
+   return 0;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Default Constructor. No boundaries specified.
 
@@ -178,6 +337,7 @@ TH2Poly::TH2Poly(const char *name,const char *title,
 
 TH2Poly::~TH2Poly()
 {
+   delete fBinTree.load();
    delete[] fCells;
    delete[] fIsEmpty;
    delete[] fCompletelyInside;
@@ -245,6 +405,7 @@ Int_t TH2Poly::AddBin(TObject *poly)
 
    fBins->Add((TObject*) bin);
    SetNewBinAdded(kTRUE);
+   ResetBinTree();
 
    // Adds the bin to the partition matrix
    AddBinToPartition(bin);
@@ -460,6 +621,7 @@ void TH2Poly::ChangePartition(Int_t n, Int_t m)
    fCellY = m;                          // Set the number of cells
 
    delete [] fCells;                    // Deletes the old partition
+   ResetBinTree();
 
    // number of cells in the grid
    //N.B. not to be confused with fNcells (the number of bins) !
@@ -571,28 +733,8 @@ Int_t TH2Poly::FindBin(Double_t x, Double_t y, Double_t)
    else if (x > fXaxis.GetXmin()) overflow += -1;
    if (overflow != -5) return overflow;
 
-   // Finds the cell (x,y) coordinates belong to
-   Int_t n = (Int_t)(floor((x-fXaxis.GetXmin())/fStepX));
-   Int_t m = (Int_t)(floor((y-fYaxis.GetXmin())/fStepY));
-
-   // Make sure the array indices are correct.
-   if (n>=fCellX) n = fCellX-1;
-   if (m>=fCellY) m = fCellY-1;
-   if (n<0)       n = 0;
-   if (m<0)       m = 0;
-
-   if (fIsEmpty[n+fCellX*m]) return -5;
-
-   TH2PolyBin *bin;
-
-   TIter next(&fCells[n+fCellX*m]);
-   TObject *obj;
-
-   // Search for the bin in the cell
-   while ((obj=next())) {
-      bin  = (TH2PolyBin*)obj;
-      if (bin->IsInside(x,y)) return bin->GetBinNumber();
-   }
+   TH2PolyBin *bin = GetBinTree()->FindBin(x, y);
+   if (bin) return bin->GetBinNumber();
 
    // If the search has not returned a bin, the point must be on "the sea"
    return -5;
@@ -614,65 +756,84 @@ Int_t TH2Poly::Fill(Double_t x, Double_t y)
 Int_t TH2Poly::Fill(Double_t x, Double_t y, Double_t w)
 {
    if (fNcells <= kNOverflow) return 0;
+
+   TH2PolyBin *bin = GetBinTree()->FindBin(x, y);
+   if (bin) return FillBin(bin, x, y, w);
+   return FillOverflow(x, y, w);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Increment "bin", which contains (x,y), by w and update the statistics.
+/// Returns the bin number.
+
+Int_t TH2Poly::FillBin(TH2PolyBin *bin, Double_t x, Double_t y, Double_t w)
+{
+   bin->Fill(w);
+
+   // Statistics
+   fTsumw   = fTsumw + w;
+   fTsumwx  = fTsumwx + w*x;
+   fTsumwx2 = fTsumwx2 + w*x*x;
+   fTsumwy  = fTsumwy + w*y;
+   fTsumwy2 = fTsumwy2 + w*y*y;
+   // needs to account offset in array for overflow bins
+   if (fSumw2.fN) fSumw2.fArray[bin->GetBinNumber()-1+kNOverflow] += w*w;
+   fEntries++;
+
+   SetBinContentChanged(kTRUE);
+
+   return bin->GetBinNumber();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Increment the overflow bin of (x,y), which is not contained in any bin,
+/// by w. Returns the overflow bin number, -5 being the "sea" bin.
+
+Int_t TH2Poly::FillOverflow(Double_t x, Double_t y, Double_t w)
+{
    Int_t overflow = 0;
    if      (y > fYaxis.GetXmax()) overflow += -1;
    else if (y > fYaxis.GetXmin()) overflow += -4;
    else                           overflow += -7;
    if      (x > fXaxis.GetXmax()) overflow += -2;
    else if(x > fXaxis.GetXmin())  overflow += -1;
-   if (overflow != -5) {
-      fOverflow[-overflow - 1]+= w;
-      if (fSumw2.fN) fSumw2.fArray[-overflow - 1] += w*w;
-      return overflow;
-   }
-
-   // Finds the cell (x,y) coordinates belong to
-   Int_t n = (Int_t)(floor((x-fXaxis.GetXmin())/fStepX));
-   Int_t m = (Int_t)(floor((y-fYaxis.GetXmin())/fStepY));
-
-   // Make sure the array indices are correct.
-   if (n>=fCellX) n = fCellX-1;
-   if (m>=fCellY) m = fCellY-1;
-   if (n<0)       n = 0;
-   if (m<0)       m = 0;
-
-   if (fIsEmpty[n+fCellX*m]) {
-      fOverflow[4]+= w;
-      if (fSumw2.fN) fSumw2.fArray[4] += w*w;
-      return -5;
-   }
 
-   TH2PolyBin *bin;
-   Int_t bi;
-
-   TIter next(&fCells[n+fCellX*m]);
-   TObject *obj;
-
-   while ((obj=next())) {
-      bin  = (TH2PolyBin*)obj;
-      // needs to account offset in array for overflow bins
-      bi = bin->GetBinNumber()-1+kNOverflow;
-      if (bin->IsInside(x,y)) {
-         bin->Fill(w);
-
-         // Statistics
-         fTsumw   = fTsumw + w;
-         fTsumwx  = fTsumwx + w*x;
-         fTsumwx2 = fTsumwx2 + w*x*x;
-         fTsumwy  = fTsumwy + w*y;
-         fTsumwy2 = fTsumwy2 + w*y*y;
-         if (fSumw2.fN) fSumw2.fArray[bi] += w*w;
-         fEntries++;
+   fOverflow[-overflow - 1]+= w;
+   if (fSumw2.fN) fSumw2.fArray[-overflow - 1] += w*w;
+   return overflow;
+}
 
-         SetBinContentChanged(kTRUE);
+////////////////////////////////////////////////////////////////////////////////
+/// Return the spatial index of the bins, building it if needed.
+/// Concurrent lookups (FindBin()) build it only once; changes of the bins
+/// must not run concurrently with lookups.
 
-         return bin->GetBinNumber();
-      }
+const TH2PolyBinTree *TH2Poly::GetBinTree()
+{
+   TH2PolyBinTree *tree = fBinTree.load(std::memory_order_acquire);
+   if (tree)
+      return tree;
+
+   static std::mutex buildMutex;
+   std::lock_guard<std::mutex> lock(buildMutex);
+   tree = fBinTree.load(std::memory_order_relaxed);
+   if (!tree) {
+      tree = new TH2PolyBinTree(fBins, fXaxis.GetXmin(), fXaxis.GetXmax(),
+                                fYaxis.GetXmin(), fYaxis.GetXmax());
+      fBinTree.store(tree, std::memory_order_release);
    }
+   return tree;
+}
 
-   fOverflow[4]+= w;
-   if (fSumw2.fN) fSumw2.fArray[4] += w*w;
-   return -5;
+////////////////////////////////////////////////////////////////////////////////
+/// Discard the spatial index of the bins; it is rebuilt when next needed.
+/// Called when bins are added or the partition changes, and after reading
+/// the histogram (see the I/O rule in LinkDef.h), since the bins are then
+/// replaced.
+
+void TH2Poly::ResetBinTree()
+{
+   delete fBinTree.exchange(nullptr);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -701,19 +862,48 @@ Int_t TH2Poly::Fill(const char* name, Double_t w)
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Fills a 2-D histogram with an array of values and weights.
+/// If implicit multi-threading is enabled, the bins containing the points
+/// are looked up in parallel; the bins are then filled in the order of the
+/// points.
 ///
 /// \param [in] ntimes:  number of entries in arrays x and w
 ///                      (array size must be ntimes*stride)
 /// \param [in] x:       array of x values to be histogrammed
 /// \param [in] y:       array of y values to be histogrammed
-/// \param [in] w:       array of weights
+/// \param [in] w:       array of weights, or 0 for unit weights
 /// \param [in] stride:  step size through arrays x, y and w
 
 void TH2Poly::FillN(Int_t ntimes, const Double_t* x, const Double_t* y,
                                const Double_t* w, Int_t stride)
 {
-   for (int i = 0; i < ntimes; i += stride) {
-      Fill(x[i], y[i], w[i]);
+   if (fNcells <= kNOverflow || ntimes <= 0) return;
+
+   const TH2PolyBinTree *tree = GetBinTree();
+   std::vector<TH2PolyBin*> bins(ntimes);
+   auto findBins = [&](Int_t begin, Int_t end) {
+      for (Int_t i = begin; i < end; ++i)
+         bins[i] = tree->FindBin(x[i*stride], y[i*stride]);
+   };
+
+#ifdef R__USE_IMT
+   const Int_t chunkSize = 1024;
+   if (ROOT::IsImplicitMTEnabled() && ntimes > chunkSize) {
+      const UInt_t nChunks = (ntimes + chunkSize - 1) / chunkSize;
+      ROOT::TThreadExecutor pool;
+      pool.Foreach([&](UInt_t chunk) {
+         findBins(chunk * chunkSize, std::min<Int_t>(ntimes, (chunk + 1) * chunkSize));
+      }, ROOT::TSeq<UInt_t>(0, nChunks));
+   } else {
+      findBins(0, ntimes);
+   }
+#else
+   findBins(0, ntimes);
+#endif
+
+   for (Int_t i = 0; i < ntimes; ++i) {
+      const Double_t wi = w ? w[i*stride] : 1.;
+      if (bins[i]) FillBin(bins[i], x[i*stride], y[i*stride], wi);
+      else         FillOverflow(x[i*stride], y[i*stride], wi);
    }
 }
 
@@ -959,6 +1149,7 @@ void TH2Poly::Initialize(Double_t xlow, Double_t xup,
    fDimension = 2;  //The dimension of the histogram
 
    fBins   = 0;
+   fBinTree = nullptr;
    fNcells = kNOverflow;
 
    // Sets the boundaries of the histogram
@@ -324,6 +324,22 @@ THnBase* THnBase::CreateHnAny(const char* name, const char* title,
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Fill n points in one go. x holds the coordinates of the points one after
+/// the other, i.e. GetNdimensions() values per point, and w their weights
+/// (all weights are 1 if w is null).
+/// This is equivalent to calling Fill(x + i * GetNdimensions(), w[i]) for
+/// each point i.
+
+void THnBase::FillN(Int_t n, const Double_t *x, const Double_t *w /*= nullptr*/)
+{
+   for (Int_t i = 0; i < n; ++i, x += fNdimensions) {
+      const Double_t wi = w ? w[i] : 1.;
+      UpdateXStat(x, wi);
+      FillBin(GetBin(x, kTRUE /*alloc*/), wi);
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Fill the THnBase with the bins of hist that have content
 /// or error != 0.
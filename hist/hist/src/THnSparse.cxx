@@ -17,6 +17,8 @@
 #include "TDataMember.h"
 #include "TDataType.h"
 
+#include <vector>
+
 namespace {
 //______________________________________________________________________________
 //
@@ -271,9 +273,9 @@ ULong64_t THnSparseCoordCompression::GetHashFromCoords(const Int_t* coord) const
 {
    // Bins are addressed in two different modes, depending
    // on whether the compact bin index fits into a Long64_t or not.
-   // If it does, we can use it as a "perfect hash" for the TExMap.
+   // If it does, we can use it as a "perfect hash" for the THnSparseBinHash.
    // If not we build a hash from the compact bin index, and use that
-   // as the TExMap's hash.
+   // as the THnSparseBinHash's hash.
 
    if (fCoordBufferSize <= 8) {
       // fits into a Long64_t
@@ -319,9 +321,9 @@ ULong64_t THnSparseCoordCompression::GetHashFromBuffer(const Char_t* buf) const
 {
    // Bins are addressed in two different modes, depending
    // on whether the compact bin index fits into a Long64_t or not.
-   // If it does, we can use it as a "perfect hash" for the TExMap.
+   // If it does, we can use it as a "perfect hash" for the THnSparseBinHash.
    // If not we build a hash from the compact bin index, and use that
-   // as the TExMap's hash.
+   // as the THnSparseBinHash's hash.
 
    if (fCoordBufferSize <= 8) {
       // fits into a Long64_t
@@ -410,6 +412,112 @@ THnSparseCompactBinCoord::~THnSparseCompactBinCoord()
    delete [] fCurrentBin;
 }
 
+/** \class THnSparseBinHash
+THnSparseBinHash is used internally by THnSparse to translate the hash of a
+compact bin coordinate into the linear index of the bin within the chunks.
+It is an open-addressing hash table with linear probing: each slot stores the
+hash and the linear index + 1 (0 marks an empty slot) next to each other, so
+a lookup usually touches a single cache line. Bins whose coordinates share a
+hash simply occupy further slots of the same probe sequence. The table is
+kept at most half full and doubles its capacity when needed.
+*/
+
+class THnSparseBinHash {
+public:
+   struct Slot {
+      ULong64_t fHash; // hash of the compact bin coordinate
+      Long64_t  fIdx;  // linear bin index + 1; 0 if the slot is empty
+   };
+
+   Long64_t GetSize() const { return fSize; }
+   Long64_t GetCapacity() const { return fSlots.size(); }
+
+   ////////////////////////////////////////////////////////////////////////////////
+   /// Remove all entries and release the memory.
+
+   void Clear() {
+      std::vector<Slot>().swap(fSlots);
+      fSize = 0;
+      fMask = 0;
+   }
+
+   ////////////////////////////////////////////////////////////////////////////////
+   /// Make sure "n" entries can be stored without rehashing.
+
+   void Reserve(Long64_t n) {
+      if (2 * n <= GetCapacity())
+         return;
+      ULong64_t capacity = 16;
+      while (capacity < 2 * (ULong64_t)n)
+         capacity *= 2;
+      Rehash(capacity);
+   }
+
+   ////////////////////////////////////////////////////////////////////////////////
+   /// Add the linear bin index "idx" for "hash"; the bin must not be in the
+   /// table yet.
+
+   void Insert(ULong64_t hash, Long64_t idx) {
+      Reserve(fSize + 1);
+      ULong64_t slot = FirstSlot(hash);
+      while (fSlots[slot].fIdx)
+         slot = (slot + 1) & fMask;
+      fSlots[slot].fHash = hash;
+      fSlots[slot].fIdx = idx + 1;
+      ++fSize;
+   }
+
+   ////////////////////////////////////////////////////////////////////////////////
+   /// Return the linear index of the bin with hash "hash" for which
+   /// "matches(idx)" returns true, or -1 if there is none.
+
+   template <class MATCHES>
+   Long64_t Find(ULong64_t hash, MATCHES &&matches) const {
+      if (!fSize)
+         return -1;
+      for (ULong64_t slot = FirstSlot(hash); fSlots[slot].fIdx; slot = (slot + 1) & fMask) {
+         if (fSlots[slot].fHash == hash && matches(fSlots[slot].fIdx - 1))
+            return fSlots[slot].fIdx - 1;
+      }
+      return -1;
+   }
+
+private:
+   ////////////////////////////////////////////////////////////////////////////////
+   /// Start of the probe sequence for "hash". The hash is mixed first: perfect
+   /// hashes (the compact coordinate itself) have most of their entropy in the
+   /// low bits of few bytes, and neighbouring bins must not cluster.
+
+   ULong64_t FirstSlot(ULong64_t hash) const {
+      hash ^= hash >> 33;
+      hash *= 0xff51afd7ed558ccdULL;
+      hash ^= hash >> 33;
+      return hash & fMask;
+   }
+
+   ////////////////////////////////////////////////////////////////////////////////
+   /// Move all entries into a table of "capacity" (a power of 2) slots.
+
+   void Rehash(ULong64_t capacity) {
+      std::vector<Slot> old(capacity, Slot{0, 0});
+      old.swap(fSlots);
+      fMask = capacity - 1;
+      for (const Slot &entry: old) {
+         if (!entry.fIdx)
+            continue;
+         ULong64_t slot = FirstSlot(entry.fHash);
+         while (fSlots[slot].fIdx)
+            slot = (slot + 1) & fMask;
+         fSlots[slot] = entry;
+      }
+   }
+
+   std::vector<Slot> fSlots; // the hash table, capacity is a power of 2
+   Long64_t fSize = 0;       // number of filled slots
+   ULong64_t fMask = 0;      // capacity - 1
+};
+
+
 /** \class THnSparseArrayChunk
 THnSparseArrayChunk is used internally by THnSparse.
 THnSparse stores its (dynamic size) array of bin coordinates and their
@@ -571,14 +679,14 @@ Translation from an n-dimensional bin coordinate to the linear index within
 the chunks is done by GetBin(). It creates a hash from the compacted bin
 coordinates (the hash of a bin coordinate is the compacted coordinate itself
 if it takes less than 8 bytes, the size of a Long64_t.
-This hash is used to lookup the linear index in the TExMap member fBins;
-the coordinates of the entry fBins points to is compared to the coordinates
-passed to GetBin(). If they do not match, these two coordinates have the same
-hash - which is extremely unlikely but (for the case where the compact bin
-coordinates are larger than 4 bytes) possible. In this case, fBinsContinued
-contains a chain of linear indexes with the same hash. Iterating through this
-chain and comparing each bin coordinates with the one passed to GetBin() will
-retrieve the matching bin.
+This hash is used to lookup the linear index in the open-addressing hash
+table THnSparseBinHash held by fBinHash, which is not streamed but rebuilt
+from the chunks when needed. The coordinates of each entry with the same hash
+along the probe sequence are compared to the coordinates passed to GetBin()
+until a matching bin is found. Different coordinates with the same hash are
+extremely unlikely but (for the case where the compact bin coordinates are
+larger than 8 bytes) possible; they simply occupy further slots of the probe
+sequence.
 */
 
 
@@ -588,7 +696,7 @@ ClassImp(THnSparse);
 /// Construct an empty THnSparse.
 
 THnSparse::THnSparse():
-   fChunkSize(1024), fFilledBins(0), fCompactCoord(0)
+   fChunkSize(1024), fFilledBins(0), fBinHash(0), fCompactCoord(0)
 {
    fBinContent.SetOwner();
 }
@@ -605,7 +713,7 @@ THnSparse::THnSparse(const char* name, const char* title, Int_t dim,
                      const Int_t* nbins, const Double_t* xmin, const Double_t* xmax,
                      Int_t chunksize):
    THnBase(name, title, dim, nbins, xmin, xmax),
-   fChunkSize(chunksize), fFilledBins(0), fCompactCoord(0)
+   fChunkSize(chunksize), fFilledBins(0), fBinHash(0), fCompactCoord(0)
 {
    fCompactCoord = new THnSparseCompactBinCoord(dim, nbins);
    fBinContent.SetOwner();
@@ -615,6 +723,7 @@ THnSparse::THnSparse(const char* name, const char* title, Int_t dim,
 /// Destruct a THnSparse
 
 THnSparse::~THnSparse() {
+   delete fBinHash;
    delete fCompactCoord;
 }
 
@@ -651,36 +760,34 @@ void THnSparse::InitStorage(Int_t* nbins, Int_t chunkSize)
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-///We have been streamed; set up fBins
+/// Return the hash table translating bin coordinates into linear bin indexes,
+/// creating it if needed.
+
+THnSparseBinHash* THnSparse::GetBinHash()
+{
+   if (!fBinHash)
+      fBinHash = new THnSparseBinHash();
+   return fBinHash;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+///We have been streamed; set up fBinHash
 
 void THnSparse::FillExMap()
 {
    TIter iChunk(&fBinContent);
    THnSparseArrayChunk* chunk = 0;
    THnSparseCoordCompression compactCoord(*GetCompactCoord());
+   THnSparseBinHash* binHash = GetBinHash();
    Long64_t idx = 0;
-   if (2 * GetNbins() > fBins.Capacity())
-      fBins.Expand(3 * GetNbins());
+   binHash->Reserve(GetNbins());
    while ((chunk = (THnSparseArrayChunk*) iChunk())) {
       const Int_t chunkSize = chunk->GetEntries();
       Char_t* buf = chunk->fCoordinates;
       const Int_t singleCoordSize = chunk->fSingleCoordinateSize;
       const Char_t* endbuf = buf + singleCoordSize * chunkSize;
-      for (; buf < endbuf; buf += singleCoordSize, ++idx) {
-         Long64_t hash = compactCoord.GetHashFromBuffer(buf);
-         Long64_t linidx = fBins.GetValue(hash);
-         if (linidx) {
-            Long64_t nextidx = linidx;
-            while (nextidx) {
-               // must be a collision, so go to fBinsContinued.
-               linidx = nextidx;
-               nextidx = fBinsContinued.GetValue(linidx);
-            }
-            fBinsContinued.Add(linidx, idx + 1);
-         } else {
-            fBins.Add(hash, idx + 1);
-         }
-      }
+      for (; buf < endbuf; buf += singleCoordSize, ++idx)
+         binHash->Insert(compactCoord.GetHashFromBuffer(buf), idx);
    }
 }
 
@@ -688,12 +795,10 @@ void THnSparse::FillExMap()
 /// Initialize storage for nbins
 
 void THnSparse::Reserve(Long64_t nbins) {
-   if (!fBins.GetSize() && fBinContent.GetSize()) {
+   if (!GetBinHash()->GetSize() && fBinContent.GetSize()) {
       FillExMap();
    }
-   if (2 * nbins > fBins.Capacity()) {
-      fBins.Expand(3 * nbins);
-   }
+   fBinHash->Reserve(nbins);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -791,21 +896,14 @@ Long64_t THnSparse::GetBinIndexForCurrentBin(Bool_t allocate)
 {
    THnSparseCompactBinCoord* cc = GetCompactCoord();
    ULong64_t hash = cc->GetHash();
-   if (fBinContent.GetSize() && !fBins.GetSize())
+   THnSparseBinHash* binHash = GetBinHash();
+   if (fBinContent.GetSize() && !binHash->GetSize())
       FillExMap();
-   Long64_t linidx = (Long64_t) fBins.GetValue(hash);
-   while (linidx) {
-      // fBins stores index + 1!
-      THnSparseArrayChunk* chunk = GetChunk((linidx - 1)/ fChunkSize);
-      if (chunk->Matches((linidx - 1) % fChunkSize, cc->GetBuffer()))
-         return linidx - 1; // we store idx+1, 0 is "TExMap: not found"
-
-      Long64_t nextlinidx = fBinsContinued.GetValue(linidx);
-      if (!nextlinidx) break;
-
-      linidx = nextlinidx;
-   }
-   if (!allocate) return -1;
+   const Char_t* buf = cc->GetBuffer();
+   Long64_t linidx = binHash->Find(hash, [this, buf](Long64_t idx) {
+      return GetChunk(idx / fChunkSize)->Matches(idx % fChunkSize, buf);
+   });
+   if (linidx >= 0 || !allocate) return linidx;
 
    ++fFilledBins;
 
@@ -816,20 +914,11 @@ Long64_t THnSparse::GetBinIndexForCurrentBin(Bool_t allocate)
       chunk = AddChunk();
       newidx = 0;
    }
-   chunk->AddBin(newidx, cc->GetBuffer());
+   chunk->AddBin(newidx, buf);
 
    // store translation between hash and bin
    newidx += (fBinContent.GetEntriesFast() - 1) * fChunkSize;
-   if (!linidx) {
-      // fBins didn't find it
-      if (2 * GetNbins() > fBins.Capacity())
-         fBins.Expand(3 * GetNbins());
-      fBins.Add(hash, newidx + 1);
-   } else {
-      // fBins contains one, but it's the wrong one;
-      // add entry to fBinsContinued.
-      fBinsContinued.Add(linidx, newidx + 1);
-   }
+   binHash->Insert(hash, newidx);
    return newidx;
 }
 
@@ -881,7 +970,8 @@ Double_t THnSparse::GetSparseFractionMem() const {
 
    Double_t size = 0.;
    size += fBinContent.GetEntries() * (GetChunkSize() * sizePerChunkElement + sizeof(THnSparseArrayChunk));
-   size += + 3 * sizeof(Long64_t) * fBins.GetSize() /* TExMap */;
+   if (fBinHash)
+      size += sizeof(THnSparseBinHash::Slot) * fBinHash->GetCapacity();
 
    Double_t nbinsTotal = 1.;
    for (Int_t d = 0; d < fNdimensions; ++d)
@@ -963,8 +1053,8 @@ void THnSparse::Sumw2()
 void THnSparse::Reset(Option_t *option /*= ""*/)
 {
    fFilledBins = 0;
-   fBins.Delete();
-   fBinsContinued.Clear();
+   if (fBinHash)
+      fBinHash->Clear();
    fBinContent.Delete();
    ResetBase(option);
 }
@@ -22,6 +22,16 @@
  
  The algorithm is briefly described in (4). A binned version is also implemented to address the 
  performance issue due to its data size dependance.
+
+ With the evaluation option TKDE::kFFT (option "Evaluation:FFT" or SetEvaluation()) the estimate
+ is computed once on a fine equidistant grid, by binning the data linearly onto the grid and
+ convolving it with the kernel (via FFT using TVirtualFFT if available, directly otherwise), and
+ then interpolated linearly. For the adaptive iteration the pilot estimate is taken from the grid
+ and the adaptive kernels are summed per grid point. By default the grid spacing is a twentieth
+ of the smallest bandwidth, which keeps the relative deviation from the exact estimate at the
+ per mille level; it can be changed with the number of grid points passed to SetEvaluation().
+ With implicit multi-threading enabled when the TKDE is built, the exact evaluation
+ (TKDE::kExact) of large data sets with a built-in kernel runs in parallel.
  */
 
 
@@ -30,6 +40,7 @@
 #include <numeric>
 #include <limits>
 #include <cassert>
+#include <memory>
 
 #include "Math/Error.h"
 #include "TMath.h"
@@ -42,6 +53,13 @@
 #include "TH1.h"
 #include "TCanvas.h"
 #include "TKDE.h"
+#include "TPluginManager.h"
+#include "TROOT.h"
+#include "TVirtualFFT.h"
+
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#endif
 
 
 ClassImp(TKDE);
@@ -50,9 +68,21 @@ class TKDE::TKernel {
    TKDE* fKDE;
    UInt_t fNWeights; // Number of kernel weights (bandwidth as vectorized for binning)
    std::vector<Double_t> fWeights; // Kernel weights (bandwidth)
+   std::vector<Double_t> fGrid; // Not normalized estimate on the grid for the FFT evaluation option
+   Double_t fGridMin;  // Position of the first grid point
+   Double_t fGridStep; // Distance between the grid points
+#ifdef R__USE_IMT
+   std::unique_ptr<ROOT::TThreadExecutor> fPool; // Executor of the parallel sums, created once if implicit MT is enabled
+#endif
+   Double_t Sum(Double_t x, UInt_t first, UInt_t last) const;
+   Double_t ComputeSum(Double_t x) const;
+   Double_t Interpolate(Double_t x) const;
+   Double_t GetNormalization() const;
+   void Evaluate(const std::vector<Double_t>& x, std::vector<Double_t>& result) const;
 public:
    TKernel(Double_t weight, TKDE* kde);
    void ComputeAdaptiveWeights();
+   void ComputeGrid(Double_t fixedWeight, Bool_t adaptive);
    Double_t operator()(Double_t x) const;
    Double_t GetWeight(Double_t x) const;
    Double_t GetFixedWeight() const;
@@ -128,6 +158,7 @@ void TKDE::Instantiate(KernelFunction_Ptr kernfunc, UInt_t events, const Double_
    fUseMirroring = false; fMirrorLeft = false; fMirrorRight = false;
    fAsymLeft = false; fAsymRight = false; 
    fNBins = events < 10000 ? 100 : events / 10;
+   fNGrid = 0;
    fNEvents = events;
    fUseBinsNEvents = 10000;
    fMean = 0.0;
@@ -141,7 +172,7 @@ void TKDE::Instantiate(KernelFunction_Ptr kernfunc, UInt_t events, const Double_
    fWeightSize = 0;
    fCanonicalBandwidths = std::vector<Double_t>(kTotalKernels, 0.0);
    fKernelSigmas2 = std::vector<Double_t>(kTotalKernels, -1.0);
-   fSettedOptions = std::vector<Bool_t>(4, kFALSE);
+   fSettedOptions = std::vector<Bool_t>(5, kFALSE);
    SetOptions(option, rho);
    CheckOptions(kTRUE);
    SetMirror();
@@ -155,7 +186,7 @@ void TKDE::SetOptions(const Option_t* option, Double_t rho) {
    TString opt = option;
    opt.ToLower();
    std::string options = opt.Data();
-   size_t numOpt = 4;
+   size_t numOpt = 5;
    std::vector<std::string> voption(numOpt, "");
    for (std::vector<std::string>::iterator it = voption.begin(); it != voption.end() && !options.empty(); ++it) {
       size_t pos = options.find_last_of(';');
@@ -284,6 +315,16 @@ void TKDE::GetOptions(std::string optionType, std::string option) {
          this->Warning("GetOptions", "Unknown binning option: setting to RelaxedBinning");
          fBinning = kRelaxedBinning;
       }
+   } else if (optionType.compare("evaluation") == 0) {
+      fSettedOptions[4] = kTRUE;
+      if (option.compare("exact") == 0) {
+         fEvaluation = kExact;
+      } else if (option.compare("fft") == 0) {
+         fEvaluation = kFFT;
+      } else {
+         this->Warning("GetOptions", "Unknown evaluation option: setting to Exact");
+         fEvaluation = kExact;
+      }
    }
 }
 
@@ -301,6 +342,9 @@ void TKDE::AssureOptions() {
    if (!fSettedOptions[3]) {
       fBinning = kRelaxedBinning;
    }
+   if (!fSettedOptions[4]) {
+      fEvaluation = kExact;
+   }
 }
 
 void TKDE::CheckOptions(Bool_t isUserDefinedKernel) {
@@ -320,6 +364,10 @@ void TKDE::CheckOptions(Bool_t isUserDefinedKernel) {
       Warning("CheckOptions", "Illegal user binning type input - use default value !");
       fBinning = kRelaxedBinning;
    }
+   if (fEvaluation != kExact && fEvaluation != kFFT) {
+      Warning("CheckOptions", "Illegal user evaluation type input - use default value !");
+      fEvaluation = kExact;
+   }
    if (fRho <= 0.0) {
       Warning("CheckOptions", "Tuning factor rho cannot be non-positive - use default value !");
       fRho = 1.0;
@@ -391,6 +439,16 @@ void TKDE::SetUseBinsNEvents(UInt_t nEvents) {
    SetKernel();
 }
 
+void TKDE::SetEvaluation(EEvaluation eval, UInt_t ngrid) {
+   // Sets User option for evaluating the KDE exactly or by interpolating its values on a grid,
+   // computed via FFT convolution. ngrid is the number of grid points; by default (0) the grid
+   // spacing is a twentieth of the smallest bandwidth
+   fEvaluation = eval;
+   fNGrid = ngrid;
+   CheckOptions();
+   SetKernel();
+}
+
 void TKDE::SetTuneFactor(Double_t rho) {
    // Factor which can be used to tune the smoothing.
    // It is used as multiplicative factor for the fixed and adaptive bandwidth.
@@ -550,6 +608,9 @@ void TKDE::SetKernel() {
    weight *= fRho * fCanonicalBandwidths[fKernelType] / fCanonicalBandwidths[kGaussian];
    if (fKernel) delete fKernel;
    fKernel = new TKernel(weight, this);
+   if (fEvaluation == kFFT) {
+      fKernel->ComputeGrid(weight, kFALSE);
+   }
    if (fIteration == kAdaptive) {
       fKernel->ComputeAdaptiveWeights();
    }
@@ -696,21 +757,33 @@ TKDE::TKernel::TKernel(Double_t weight, TKDE* kde) :
 // Internal class constructor
 fKDE(kde),
 fNWeights(kde->fData.size()),
-fWeights(fNWeights, weight)
-{}
+fWeights(fNWeights, weight),
+fGridMin(0.),
+fGridStep(0.)
+{
+#ifdef R__USE_IMT
+   if (ROOT::IsImplicitMTEnabled())
+      fPool.reset(new ROOT::TThreadExecutor());
+#endif
+}
 
 void TKDE::TKernel::ComputeAdaptiveWeights() {
    // Gets the adaptive weights (bandwidths) for TKernel internal computation
    std::vector<Double_t> weights = fWeights;
+   const Double_t fixedWeight = weights[0];
    Double_t minWeight = weights[0] * 0.05;
    unsigned int n = fKDE->fData.size();
    assert( n == weights.size() );
    bool useDataWeights = (fKDE->fBinCount.size() == n); 
+   fKDE->fAdaptiveBandwidthFactor = 1.; // do not accumulate over repeated computations
+   // pilot estimate (with the fixed bandwidth) at the data points
+   std::vector<Double_t> pilot;
+   Evaluate(fKDE->fData, pilot);
    Double_t f = 0.0;
    for (unsigned int i = 0; i < n; ++i) { 
 //   for (; weight != weights.end(); ++weight, ++data, ++dataW) {
       if (useDataWeights && fKDE->fBinCount[i] <= 0) continue;  // skip negative or null weights
-      f = (*fKDE->fKernel)(fKDE->fData[i]);
+      f = pilot[i];
       if (f <= 0)
          fKDE->Warning("ComputeAdativeWeights","function value is zero or negative for x = %f w = %f",
                        fKDE->fData[i],(useDataWeights) ? fKDE->fBinCount[i] : 1.);
@@ -723,6 +796,148 @@ void TKDE::TKernel::ComputeAdaptiveWeights() {
    transform(weights.begin(), weights.end(), fWeights.begin(),
              std::bind(std::multiplies<Double_t>(), std::placeholders::_1, fKDE->fAdaptiveBandwidthFactor));
    //printf("adaptive bandwidth factor % f weight 0 %f , %f \n",fKDE->fAdaptiveBandwidthFactor, weights[0],fWeights[0] );
+   if (!fGrid.empty()) {
+      // replace the pilot estimate on the grid by the adaptive one
+      ComputeGrid(fixedWeight, kTRUE);
+   }
+}
+
+void TKDE::TKernel::ComputeGrid(Double_t fixedWeight, Bool_t adaptive) {
+   // Evaluates the (not normalized) estimate on an equidistant grid for the FFT evaluation option.
+   // The data (and the reflected data for asymmetric mirroring) are binned linearly onto the grid.
+   // With a fixed bandwidth the binned data are convolved with the sampled kernel, via FFT if
+   // TVirtualFFT is available. With adaptive bandwidths the kernel of each grid point is summed
+   // directly, using the adaptive bandwidth computed from the pilot estimate currently on the grid
+   const std::vector<Double_t>& data = fKDE->fData;
+   const UInt_t n = data.size();
+   if (n == 0) return;
+   const Bool_t useBins = (fKDE->fBinCount.size() == n);
+   const Double_t xmin2 = 2. * fKDE->fXMin;
+   const Double_t xmax2 = 2. * fKDE->fXMax;
+   // support of the kernel in units of the bandwidth; the Gaussian kernel is cut at 9 sigma
+   const Double_t support = (fKDE->fKernelType == kEpanechnikov || fKDE->fKernelType == kBiweight ||
+                             fKDE->fKernelType == kCosineArch) ? 1. : 9.;
+   const Double_t minWeight = *std::min_element(fWeights.begin(), fWeights.end());
+   const Double_t maxWeight = *std::max_element(fWeights.begin(), fWeights.end());
+
+   // grid range: all (reflected) data points plus the kernel support
+   Double_t lo = *std::min_element(data.begin(), data.end());
+   Double_t hi = *std::max_element(data.begin(), data.end());
+   const Double_t dataLo = lo, dataHi = hi;
+   if (fKDE->fAsymLeft) {
+      lo = std::min(lo, xmin2 - dataHi);
+      hi = std::max(hi, xmin2 - dataLo);
+   }
+   if (fKDE->fAsymRight) {
+      lo = std::min(lo, xmax2 - dataHi);
+      hi = std::max(hi, xmax2 - dataLo);
+   }
+   lo -= support * maxWeight;
+   hi += support * maxWeight;
+
+   const Double_t kGridPointsPerBandwidth = 20.;
+   UInt_t ngrid = fKDE->fNGrid;
+   if (ngrid < 2) {
+      const Double_t nauto = (hi - lo) / minWeight * kGridPointsPerBandwidth + 1.;
+      ngrid = (UInt_t) std::min(std::max(nauto, 1024.), Double_t(1 << 20));
+   }
+   const Double_t step = (hi - lo) / (ngrid - 1);
+
+   // linear binning
+   std::vector<Double_t> binned(ngrid, 0.);
+   auto addPoint = [&](Double_t x, Double_t count) {
+      const Double_t pos = (x - lo) / step;
+      const UInt_t j = std::min((UInt_t) std::max(pos, 0.), ngrid - 2);
+      const Double_t frac = std::min(pos - j, 1.);
+      binned[j] += count * (1. - frac);
+      binned[j + 1] += count * frac;
+   };
+   for (UInt_t i = 0; i < n; ++i) {
+      const Double_t count = useBins ? fKDE->fBinCount[i] : 1.;
+      addPoint(data[i], count);
+      if (fKDE->fAsymLeft) addPoint(xmin2 - data[i], -count);
+      if (fKDE->fAsymRight) addPoint(xmax2 - data[i], -count);
+   }
+
+   std::vector<Double_t> grid(ngrid, 0.);
+   const KernelFunction_Ptr kernel = fKDE->fKernelFunction;
+   if (adaptive) {
+      const Double_t nSum = GetNormalization();
+      for (UInt_t j = 0; j < ngrid; ++j) {
+         if (binned[j] == 0.) continue;
+         // adaptive bandwidth at the grid point, as in ComputeAdaptiveWeights()
+         const Double_t f = Interpolate(lo + j * step) / nSum;
+         Double_t h = f > 0. ? std::max(fixedWeight / std::sqrt(f), 0.05 * fixedWeight) : maxWeight;
+         h = std::min(std::max(h * fKDE->fAdaptiveBandwidthFactor, minWeight), maxWeight);
+         const Int_t width = Int_t(support * h / step) + 1;
+         const Int_t kfirst = std::max((Int_t) j - width, 0);
+         const Int_t klast = std::min((Int_t) j + width, (Int_t) ngrid - 1);
+         for (Int_t k = kfirst; k <= klast; ++k)
+            grid[k] += binned[j] / h * (*kernel)((k - (Int_t) j) * step / h);
+      }
+   } else {
+      // kernel sampled at the grid offsets -width ... width
+      const Int_t width = std::min(Int_t(support * fixedWeight / step) + 1, (Int_t) ngrid - 1);
+      std::vector<Double_t> sampled(2 * width + 1);
+      for (Int_t d = -width; d <= width; ++d)
+         sampled[d + width] = (*kernel)(d * step / fixedWeight) / fixedWeight;
+
+      // zero padded to avoid wrap around in the cyclic convolution
+      Int_t nfft = 1;
+      while (nfft < (Int_t) ngrid + width) nfft *= 2;
+      // use FFTW through TVirtualFFT if its plugin is there (avoiding errors if it is not)
+      TVirtualFFT* fftData = 0;
+      TPluginHandler *h = gROOT->GetPluginManager()->FindHandler("TVirtualFFT", "fftwr2c");
+      if (h && h->CheckPlugin() != -1)
+         fftData = TVirtualFFT::FFT(1, &nfft, "R2C K");
+      TVirtualFFT* fftKernel = fftData ? TVirtualFFT::FFT(1, &nfft, "R2C K") : 0;
+      TVirtualFFT* fftInverse = fftKernel ? TVirtualFFT::FFT(1, &nfft, "C2R K") : 0;
+      if (fftInverse) {
+         for (Int_t i = 0; i < nfft; ++i) {
+            fftData->SetPoint(i, i < (Int_t) ngrid ? binned[i] : 0.);
+            Double_t k = 0.;
+            if (i <= width) k = sampled[i + width];
+            else if (i >= nfft - width) k = sampled[i - nfft + width];
+            fftKernel->SetPoint(i, k);
+         }
+         fftData->Transform();
+         fftKernel->Transform();
+         Double_t re1, im1, re2, im2;
+         for (Int_t i = 0; i <= nfft / 2; ++i) {
+            fftData->GetPointComplex(i, re1, im1);
+            fftKernel->GetPointComplex(i, re2, im2);
+            fftInverse->SetPoint(i, re1 * re2 - im1 * im2, re1 * im2 + re2 * im1);
+         }
+         fftInverse->Transform();
+         for (UInt_t k = 0; k < ngrid; ++k)
+            grid[k] = fftInverse->GetPointReal(k) / nfft;
+      } else {
+         // no FFT available: direct convolution on the grid
+         for (UInt_t j = 0; j < ngrid; ++j) {
+            if (binned[j] == 0.) continue;
+            const Int_t kfirst = std::max((Int_t) j - width, 0);
+            const Int_t klast = std::min((Int_t) j + width, (Int_t) ngrid - 1);
+            for (Int_t k = kfirst; k <= klast; ++k)
+               grid[k] += binned[j] * sampled[k - (Int_t) j + width];
+         }
+      }
+      delete fftData;
+      delete fftKernel;
+      delete fftInverse;
+   }
+
+   fGrid.swap(grid);
+   fGridMin = lo;
+   fGridStep = step;
+}
+
+Double_t TKDE::TKernel::Interpolate(Double_t x) const {
+   // Returns the (not normalized) estimate linearly interpolated from the grid, 0 outside of it
+   const Double_t pos = (x - fGridMin) / fGridStep;
+   if (fGrid.empty() || pos < 0. || pos > fGrid.size() - 1.) return 0.;
+   const UInt_t j = std::min((UInt_t) pos, (UInt_t) fGrid.size() - 2);
+   const Double_t frac = pos - j;
+   return fGrid[j] * (1. - frac) + fGrid[j + 1] * frac;
 }
 
 Double_t TKDE::TKernel::GetWeight(Double_t x) const {
@@ -905,16 +1120,13 @@ const std::vector<Double_t> & TKDE::TKernel::GetAdaptiveWeights() const {
    return fWeights;
 }
 
-Double_t TKDE::TKernel::operator()(Double_t x) const {
-   // The internal class's unary function: returns the kernel density estimate
+Double_t TKDE::TKernel::Sum(Double_t x, UInt_t first, UInt_t last) const {
+   // Returns the not normalized sum of the kernels of the data points first ... last-1 at x
    Double_t result(0.0);
    UInt_t n = fKDE->fData.size();
    // case of bins or weighted data 
    Bool_t useBins = (fKDE->fBinCount.size() == n);
-   Double_t nSum = (useBins) ? fKDE->fSumOfCounts : fKDE->fNEvents;
-   // double dmin = 1.E10;
-   // double xmin,bmin,wmin; 
-   for (UInt_t i = 0; i < n; ++i) {
+   for (UInt_t i = first; i < last; ++i) {
       Double_t binCount = (useBins) ? fKDE->fBinCount[i] : 1.0;
       //printf("data point %i  %f  count %f weight % f result % f\n",i,fKDE->fData[i],binCount,fWeights[i], result);
       result += binCount / fWeights[i] * (*fKDE->fKernelFunction)((x - fKDE->fData[i]) / fWeights[i]);
@@ -924,24 +1136,70 @@ Double_t TKDE::TKernel::operator()(Double_t x) const {
       if (fKDE->fAsymRight) {
          result -= binCount / fWeights[i] * (*fKDE->fKernelFunction)((x - (2. * fKDE->fXMax - fKDE->fData[i])) / fWeights[i]);
       }
-      // if ( TMath::IsNaN(result) ) {
-      //    printf("event %i count %f  weight %f  data % f x %f \n",i,binCount,fWeights[i],fKDE->fData[i],x );
-      // }
-      // if ( result <= 0 ) {
-      //    printf("event %i count %f  weight %f  data % f x %f \n",i,binCount,fWeights[i],fKDE->fData[i],x );
-      // }
-      // if (std::abs(x -  fKDE->fData[i]) < dmin ) {
-      //    xmin = x;
-      //    bmin = binCount;
-      //    wmin = fWeights[i];
-      //    dmin = std::abs(x -  fKDE->fData[i]);
-      // }
+   }
+   return result;
+}
+
+Double_t TKDE::TKernel::ComputeSum(Double_t x) const {
+   // Returns the not normalized sum of the kernels of all data points at x; for many data
+   // points the sum is split in chunks summed in parallel if implicit multi-threading is enabled.
+   // User defined kernels are not assumed to be thread safe
+   UInt_t n = fKDE->fData.size();
+#ifdef R__USE_IMT
+   const UInt_t chunkSize = 16384;
+   if (fPool && ROOT::IsImplicitMTEnabled() && n > 4 * chunkSize && fKDE->fKernelType != kUserDefined) {
+      const UInt_t nChunks = (n + chunkSize - 1) / chunkSize;
+      std::vector<Double_t> partial(nChunks);
+      fPool->Foreach([&](UInt_t chunk) {
+         partial[chunk] = Sum(x, chunk * chunkSize, std::min(n, (chunk + 1) * chunkSize));
+      }, ROOT::TSeq<UInt_t>(0, nChunks));
+      // sum in a fixed order, independent of the number of threads
+      return std::accumulate(partial.begin(), partial.end(), 0.0);
+   }
+#endif
+   return Sum(x, 0, n);
+}
+
+Double_t TKDE::TKernel::GetNormalization() const {
+   // Returns the sum of counts normalizing the estimate
+   Bool_t useBins = (fKDE->fBinCount.size() == fKDE->fData.size());
+   return (useBins) ? fKDE->fSumOfCounts : fKDE->fNEvents;
+}
+
+void TKDE::TKernel::Evaluate(const std::vector<Double_t>& x, std::vector<Double_t>& result) const {
+   // Evaluates the estimate at all points x; without grid the points are evaluated in parallel
+   // if implicit multi-threading is enabled
+   result.resize(x.size());
+#ifdef R__USE_IMT
+   const UInt_t chunkSize = 256;
+   if (fPool && fGrid.empty() && ROOT::IsImplicitMTEnabled() && x.size() > chunkSize && fKDE->fKernelType != kUserDefined) {
+      const UInt_t n = fKDE->fData.size();
+      const Double_t nSum = GetNormalization();
+      const UInt_t nChunks = (x.size() + chunkSize - 1) / chunkSize;
+      fPool->Foreach([&](UInt_t chunk) {
+         const UInt_t last = std::min<UInt_t>(x.size(), (chunk + 1) * chunkSize);
+         for (UInt_t i = chunk * chunkSize; i < last; ++i)
+            result[i] = Sum(x[i], 0, n) / nSum;
+      }, ROOT::TSeq<UInt_t>(0, nChunks));
+      return;
+   }
+#endif
+   for (UInt_t i = 0; i < x.size(); ++i)
+      result[i] = (*this)(x[i]);
+}
+
+Double_t TKDE::TKernel::operator()(Double_t x) const {
+   // The internal class's unary function: returns the kernel density estimate
+   Double_t result(0.0);
+   if (!fGrid.empty() && x >= fGridMin && x <= fGridMin + (fGrid.size() - 1) * fGridStep) {
+      result = Interpolate(x);
+   } else {
+      result = ComputeSum(x);
    }
    if ( TMath::IsNaN(result) ) {
       fKDE->Warning("operator()","Result is NaN for  x %f \n",x);
-    //xmin % f , %f, %f \n",result,x,xmin,bmin,wmin );
    }
-   return result / nSum;
+   return result / GetNormalization();
 }
 
 UInt_t TKDE::Index(Double_t x) const {
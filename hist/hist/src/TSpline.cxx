@@ -221,6 +221,15 @@ void TSpline::Paint(Option_t *option)
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluate the spline at the n abscissas x and store the values in result.
+
+void TSpline::EvalN(Int_t n, const Double_t *x, Double_t *result) const
+{
+   for (Int_t i = 0; i < n; ++i)
+      result[i] = Eval(x[i]);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Stream an object of class TSpline.
 
@@ -355,7 +364,7 @@ TSpline3::TSpline3(const char *title,
                    Double_t x[], Double_t y[], Int_t n, const char *opt,
                    Double_t valbeg, Double_t valend) :
   TSpline(title,-1,x[0],x[n-1],n,kFALSE),
-  fValBeg(valbeg), fValEnd(valend), fBegCond(0), fEndCond(0)
+  fValBeg(valbeg), fValEnd(valend), fBegCond(0), fEndCond(0), fInvDelta(0)
 {
    fName="Spline3";
 
@@ -385,7 +394,7 @@ TSpline3::TSpline3(const char *title,
                    Double_t valbeg, Double_t valend) :
   TSpline(title,(xmax-xmin)/(n-1), xmin, xmax, n, kTRUE),
   fValBeg(valbeg), fValEnd(valend),
-  fBegCond(0), fEndCond(0)
+  fBegCond(0), fEndCond(0), fInvDelta(0)
 {
    fName="Spline3";
 
@@ -414,7 +423,7 @@ TSpline3::TSpline3(const char *title,
                    Double_t valbeg, Double_t valend) :
   TSpline(title,-1, x[0], x[n-1], n, kFALSE),
   fValBeg(valbeg), fValEnd(valend),
-  fBegCond(0), fEndCond(0)
+  fBegCond(0), fEndCond(0), fInvDelta(0)
 {
    fName="Spline3";
 
@@ -444,7 +453,7 @@ TSpline3::TSpline3(const char *title,
                    Double_t valbeg, Double_t valend) :
   TSpline(title,(xmax-xmin)/(n-1), xmin, xmax, n, kTRUE),
   fValBeg(valbeg), fValEnd(valend),
-  fBegCond(0), fEndCond(0)
+  fBegCond(0), fEndCond(0), fInvDelta(0)
 {
    fName="Spline3";
 
@@ -477,7 +486,7 @@ TSpline3::TSpline3(const char *title,
                    Double_t valbeg, Double_t valend) :
   TSpline(title,-1,0,0,g->GetN(),kFALSE),
   fValBeg(valbeg), fValEnd(valend),
-  fBegCond(0), fEndCond(0)
+  fBegCond(0), fEndCond(0), fInvDelta(0)
 {
    fName="Spline3";
 
@@ -507,7 +516,7 @@ TSpline3::TSpline3(const TH1 *h, const char *opt,
                    Double_t valbeg, Double_t valend) :
   TSpline(h->GetTitle(),-1,0,0,h->GetNbinsX(),kFALSE),
   fValBeg(valbeg), fValEnd(valend),
-  fBegCond(0), fEndCond(0)
+  fBegCond(0), fEndCond(0), fInvDelta(0)
 {
    fName=h->GetName();
 
@@ -537,7 +546,8 @@ TSpline3::TSpline3(const TSpline3& sp3) :
   fValBeg(sp3.fValBeg),
   fValEnd(sp3.fValEnd),
   fBegCond(sp3.fBegCond),
-  fEndCond(sp3.fEndCond)
+  fEndCond(sp3.fEndCond),
+  fInvDelta(sp3.fInvDelta)
 {
    if (fNp > 0) fPoly = new TSplinePoly3[fNp];
    for (Int_t i=0; i<fNp; ++i)
@@ -560,6 +570,7 @@ TSpline3& TSpline3::operator=(const TSpline3& sp3)
       fValEnd=sp3.fValEnd;
       fBegCond=sp3.fBegCond;
       fEndCond=sp3.fEndCond;
+      fInvDelta=sp3.fInvDelta;
    }
    return *this;
 }
@@ -746,10 +757,10 @@ Int_t TSpline3::FindX(Double_t x) const
    if(x<=fXmin) klow=0;
    else if(x>=fXmax) klow=khig;
    else {
-      if(fKstep) {
+      if(fKstep || fInvDelta > 0) {
          //
          // Equidistant knots, use histogramming
-         klow = TMath::FloorNint((x-fXmin)/fDelta);
+         klow = fKstep ? TMath::FloorNint((x-fXmin)/fDelta) : Int_t((x-fXmin)*fInvDelta);
          // Correction for rounding errors
          if (x < fPoly[klow].X())
             klow = TMath::Max(klow-1,0);
@@ -786,6 +797,25 @@ Double_t TSpline3::Eval(Double_t x) const
    return fPoly[klow].Eval(x);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Eval this spline at the n abscissas x and store the values in result.
+/// The knot interval found for an abscissa is reused for the next one when it
+/// still contains it, so sorted or clustered abscissas need no search.
+
+void TSpline3::EvalN(Int_t n, const Double_t *x, Double_t *result) const
+{
+   Int_t klow=-1;
+   for (Int_t i=0; i<n; ++i) {
+      const Double_t xi=x[i];
+      // FindX returns klow for any abscissa strictly inside (x(klow), x(klow+1))
+      if (!(klow >= 0 && klow < fNp-1 && fPoly[klow].X() < xi && xi < fPoly[klow+1].X())) {
+         klow=FindX(xi);
+         if (klow >= fNp-1 && fNp > 1) klow = fNp-2;
+      }
+      result[i]=fPoly[klow].Eval(xi);
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Derivative.
 
@@ -1045,6 +1075,19 @@ void TSpline3::BuildCoeff()
 {
    Int_t i, j, l, m;
    Double_t   divdf1,divdf3,dtau,g=0;
+
+   // Check whether the knots given as arbitrary abscissas are equidistant
+   // (e.g. the bin centers of a histogram), so that FindX can locate the
+   // knot interval directly instead of with a binary search
+   fInvDelta = 0;
+   if (!fKstep && fNp > 2) {
+      Double_t delta = (fPoly[fNp-1].X()-fPoly[0].X())/(fNp-1);
+      Bool_t equidistant = (delta > 0);
+      for (i=1; equidistant && i<fNp-1; ++i)
+         equidistant = TMath::Abs(fPoly[i].X()-(fPoly[0].X()+i*delta)) <= 1.E-6*delta;
+      if (equidistant) fInvDelta = 1./delta;
+   }
+
    //***** a tridiagonal linear system for the unknown slopes s(i) of
    //  f  at tau(i), i=1,...,n, is generated and then solved by gauss elim-
    //  ination, with s(i) ending up in c(2,i), all i.
@@ -1,8 +1,13 @@
 #include "gtest/gtest.h"
 
 #include "THn.h"
+#include "THnSparse.h"
 #include "TH1.h"
 #include "TH2.h"
+#include "TMemFile.h"
+
+#include <memory>
+#include <vector>
 
 // Filling THn
 TEST(THn, Fill) {
@@ -108,3 +113,123 @@ TEST(THn, Projection) {
 
 
 }
+
+
+// Lookup of many THnSparse bins, with compact coordinates both fitting into
+// a 64 bit hash and exceeding it (where hashes can collide): with 1000 bins
+// (10 bits with the overflow bins) per axis, from 7 dimensions on.
+TEST(THnSparse, FillLookup) {
+   for (Int_t dim: {2, 6, 7, 10}) {
+      std::vector<Int_t> bins(dim, 1000);
+      std::vector<Double_t> xmin(dim, 0.);
+      std::vector<Double_t> xmax(dim, 1000.);
+      THnSparseD hs("hs", "hs", dim, bins.data(), xmin.data(), xmax.data(), 128);
+
+      std::vector<Int_t> coord(dim);
+      auto setCoord = [&coord, dim](Int_t i) {
+         coord[0] = 1 + i % 1000;
+         coord[1] = 1 + i / 1000;
+         for (Int_t d = 2; d < dim; ++d)
+            coord[d] = 1 + (i * (d + 7)) % 1000;
+      };
+      for (Int_t i = 0; i < 5000; ++i) {
+         setCoord(i);
+         hs.AddBinContent(coord.data(), i + 1.);
+      }
+      EXPECT_EQ(5000, hs.GetNbins());
+
+      for (Int_t i = 0; i < 5000; ++i) {
+         setCoord(i);
+         Long64_t bin = hs.GetBin(coord.data(), kFALSE);
+         ASSERT_GE(bin, 0);
+         EXPECT_DOUBLE_EQ(i + 1., hs.GetBinContent(bin));
+      }
+
+      coord.assign(dim, 999);
+      EXPECT_EQ(-1, hs.GetBin(coord.data(), kFALSE));
+
+      hs.Reset();
+      EXPECT_EQ(0, hs.GetNbins());
+      coord.assign(dim, 3);
+      hs.AddBinContent(coord.data(), 2.);
+      EXPECT_EQ(1, hs.GetNbins());
+      EXPECT_DOUBLE_EQ(2., hs.GetBinContent(coord.data()));
+   }
+}
+
+// The bin lookup table is transient: it must be rebuilt after reading the
+// histogram back, including for coordinates exceeding the 64 bit hash.
+TEST(THnSparse, StreamedLookup) {
+   const Int_t dim = 8;
+   std::vector<Int_t> bins(dim, 1000);
+   std::vector<Double_t> xmin(dim, 0.);
+   std::vector<Double_t> xmax(dim, 1000.);
+   THnSparseD hs("hs", "hs", dim, bins.data(), xmin.data(), xmax.data(), 64);
+
+   std::vector<Int_t> coord(dim);
+   auto setCoord = [&coord, dim](Int_t i) {
+      coord[0] = 1 + i % 1000;
+      coord[1] = 1 + i / 1000;
+      for (Int_t d = 2; d < dim; ++d)
+         coord[d] = 1 + (i * (2 * d + 1) + d) % 1000;
+   };
+   for (Int_t i = 0; i < 3000; ++i) {
+      setCoord(i);
+      hs.AddBinContent(coord.data(), i + 1.);
+   }
+
+   TMemFile file("thnsparse_streamed.root", "RECREATE");
+   file.WriteTObject(&hs);
+   THnSparseD *obj = nullptr;
+   file.GetObject("hs", obj);
+   std::unique_ptr<THnSparseD> read(obj);
+   ASSERT_NE(nullptr, read);
+   EXPECT_EQ(hs.GetNbins(), read->GetNbins());
+   for (Int_t i = 0; i < 3000; ++i) {
+      setCoord(i);
+      EXPECT_DOUBLE_EQ(i + 1., read->GetBinContent(read->GetBin(coord.data(), kFALSE)));
+   }
+
+   // new bins can still be added to the read back histogram
+   coord.assign(dim, 1000);
+   EXPECT_EQ(-1, read->GetBin(coord.data(), kFALSE));
+   read->AddBinContent(coord.data(), 5.);
+   EXPECT_EQ(hs.GetNbins() + 1, read->GetNbins());
+   EXPECT_DOUBLE_EQ(5., read->GetBinContent(coord.data()));
+}
+
+// FillN gives the same histogram as filling the points one by one.
+TEST(THnSparse, FillN) {
+   const Int_t dim = 3, n = 1000;
+   Int_t bins[dim] = {20, 30, 40};
+   Double_t xmin[dim] = {0., 0., 0.};
+   Double_t xmax[dim] = {1., 1., 1.};
+   THnSparseD one("one", "one", dim, bins, xmin, xmax);
+   THnSparseD bulk("bulk", "bulk", dim, bins, xmin, xmax);
+   THnD dense("dense", "dense", dim, bins, xmin, xmax);
+   one.Sumw2();
+   bulk.Sumw2();
+
+   std::vector<Double_t> x(n * dim), w(n);
+   for (Int_t i = 0; i < n; ++i) {
+      for (Int_t d = 0; d < dim; ++d)
+         x[i * dim + d] = ((i * (d + 3)) % 97) / 97.;
+      w[i] = 0.5 + i % 3;
+      one.Fill(&x[i * dim], w[i]);
+   }
+   bulk.FillN(n, x.data(), w.data());
+   dense.FillN(n, x.data());
+
+   EXPECT_EQ(one.GetNbins(), bulk.GetNbins());
+   EXPECT_DOUBLE_EQ(one.GetEntries(), bulk.GetEntries());
+   EXPECT_DOUBLE_EQ(n, dense.GetEntries());
+   for (Int_t i = 0; i < n; ++i) {
+      const Double_t *xi = &x[i * dim];
+      EXPECT_DOUBLE_EQ(one.GetBinContent(one.GetBin(xi, kFALSE)), bulk.GetBinContent(bulk.GetBin(xi, kFALSE)));
+      EXPECT_DOUBLE_EQ(one.GetBinError(one.GetBin(xi, kFALSE)), bulk.GetBinError(bulk.GetBin(xi, kFALSE)));
+   }
+   for (Int_t d = 0; d < dim; ++d) {
+      std::unique_ptr<TH1D> pOne(one.Projection(d)), pBulk(bulk.Projection(d));
+      EXPECT_DOUBLE_EQ(pOne->GetMean(), pBulk->GetMean());
+   }
+}
@@ -2,6 +2,15 @@
 
 #include "TH1.h"
 #include "TH1F.h"
+#include "TH1K.h"
+#include "TH2.h"
+#include "TList.h"
+#include "TRandom3.h"
+#include "TError.h"
+#include "TROOT.h"
+
+#include <memory>
+#include <vector>
 
 // StatOverflows TH1
 TEST(TH1, StatOverflows)
@@ -30,3 +39,114 @@ TEST(TH1, StatOverflows)
    EXPECT_EQ(TH1::EStatOverflows::kConsider, h1.GetStatOverflows());
    EXPECT_EQ(TH1::EStatOverflows::kNeutral,  h2.GetStatOverflows());
 }
+
+// Merge of many histograms with the same axes (pairwise sum of the bin arrays)
+TEST(TH1, MergeSameAxes)
+{
+   TRandom3 rndm(1);
+   const int nhists = 50;
+   TH2D href("href", "href", 20, -3, 3, 30, -3, 3);
+   href.Sumw2();
+   TH2D hmerged("hmerged", "hmerged", 20, -3, 3, 30, -3, 3);
+   hmerged.Fill(0., 0., 2.);
+   href.Fill(0., 0., 2.);
+
+   std::vector<std::unique_ptr<TH2D>> hists;
+   TList inputs;
+   for (int k = 0; k < nhists; ++k) {
+      hists.emplace_back(new TH2D(TString::Format("h%d", k), "h", 20, -3, 3, 30, -3, 3));
+      // only some of the inputs are weighted
+      if (k % 3 == 0) hists.back()->Sumw2();
+      for (int i = 0; i < 100; ++i) {
+         double x = rndm.Gaus(0, 1);
+         double y = rndm.Gaus(0, 1);
+         double w = (k % 3 == 0) ? rndm.Uniform(0.5, 1.5) : 1.;
+         hists.back()->Fill(x, y, w);
+         href.Fill(x, y, w);
+      }
+      inputs.Add(hists.back().get());
+   }
+
+   EXPECT_EQ(hmerged.Merge(&inputs), href.GetEntries());
+
+   EXPECT_EQ(hmerged.GetEntries(), href.GetEntries());
+   EXPECT_NEAR(hmerged.GetMean(1), href.GetMean(1), 1.E-12);
+   EXPECT_NEAR(hmerged.GetRMS(2), href.GetRMS(2), 1.E-12);
+   EXPECT_NEAR(hmerged.GetSumOfWeights(), href.GetSumOfWeights(), 1.E-10);
+   for (int i = 0; i < href.GetNcells(); ++i) {
+      EXPECT_NEAR(hmerged.GetBinContent(i), href.GetBinContent(i), 1.E-10);
+      EXPECT_NEAR(hmerged.GetBinError(i), href.GetBinError(i), 1.E-10);
+   }
+
+   // histograms of different types are merged bin by bin
+   TH2F hfloat("hfloat", "hfloat", 20, -3, 3, 30, -3, 3);
+   hfloat.Fill(0., 0., 2.);
+   EXPECT_EQ(hfloat.Merge(&inputs), href.GetEntries());
+   for (int i = 0; i < href.GetNcells(); ++i)
+      EXPECT_NEAR(hfloat.GetBinContent(i), href.GetBinContent(i), 1.E-4);
+}
+
+#ifdef R__USE_IMT
+// Merge with implicit MT of histograms with more cells than the size of the ranges
+// summed in parallel
+TEST(TH1, MergeSameAxesMT)
+{
+   ROOT::EnableImplicitMT(4);
+   TRandom3 rndm(2);
+   const int nhists = 12;
+   TH2F href("hrefmt", "hrefmt", 150, -3, 3, 100, -3, 3);
+   href.Sumw2();
+   TH2F hmerged("hmergedmt", "hmergedmt", 150, -3, 3, 100, -3, 3);
+   hmerged.Sumw2();
+   ASSERT_GT(hmerged.GetNcells(), 4096);
+
+   std::vector<std::unique_ptr<TH2F>> hists;
+   TList inputs;
+   for (int k = 0; k < nhists; ++k) {
+      hists.emplace_back(new TH2F(TString::Format("hmt%d", k), "h", 150, -3, 3, 100, -3, 3));
+      hists.back()->Sumw2();
+      for (int i = 0; i < 5000; ++i) {
+         double x = rndm.Gaus(0, 1.5);
+         double y = rndm.Gaus(0, 1.5);
+         double w = rndm.Uniform(0.5, 1.5);
+         hists.back()->Fill(x, y, w);
+         href.Fill(x, y, w);
+      }
+      inputs.Add(hists.back().get());
+   }
+
+   EXPECT_EQ(hmerged.Merge(&inputs), href.GetEntries());
+   ROOT::DisableImplicitMT();
+
+   EXPECT_EQ(hmerged.GetEntries(), href.GetEntries());
+   for (int i = 0; i < href.GetNcells(); ++i) {
+      EXPECT_NEAR(hmerged.GetBinContent(i), href.GetBinContent(i), 1.E-3);
+      EXPECT_NEAR(hmerged.GetBinError(i), href.GetBinError(i), 1.E-3);
+   }
+}
+#endif
+
+// The array of a TH1K holds the filled values, not the bin contents: the merge must not
+// use it as an array of bins
+TEST(TH1, MergeTH1K)
+{
+   TH1K hmerged("hk", "hk", 200, 0, 1);
+   TH1K hk("hk1", "hk1", 200, 0, 1);
+   hmerged.Fill(0.25);
+   hmerged.Fill(0.5);
+   for (int i = 0; i < 10; ++i)
+      hk.Fill(0.05 * i);
+   TList inputs;
+   inputs.Add(&hk);
+
+   // TH1K has no AddBinContent: ignore the errors of the bin by bin merge
+   Int_t level = gErrorIgnoreLevel;
+   gErrorIgnoreLevel = kFatal;
+   hmerged.Merge(&inputs);
+   gErrorIgnoreLevel = level;
+
+   EXPECT_EQ(100, hmerged.GetSize());
+   EXPECT_FLOAT_EQ(0.25, hmerged.GetArray()[0]);
+   EXPECT_FLOAT_EQ(0.5, hmerged.GetArray()[1]);
+   EXPECT_EQ(12, hmerged.GetEntries());
+}
@@ -0,0 +1,164 @@
+#include "gtest/gtest.h"
+
+#include "TF1.h"
+#include "TF2.h"
+#include "TFormula.h"
+#include "TFitResult.h"
+#include "TGraph.h"
+#include "TH1D.h"
+#include "RConfigure.h"
+#include "Math/WrappedMultiTF1.h"
+
+#include <cmath>
+#include <vector>
+
+// EvalN on a formula must give the same values as the point by point evaluation
+TEST(TFormula, EvalN)
+{
+   TFormula f("f_evaln", "[0]*exp(-0.5*((x-[1])/[2])^2) + [3]*y");
+   f.SetParameters(2., 0.5, 1.5, 0.3);
+
+   const Int_t n = 1000;
+   std::vector<Double_t> xy(2 * n), result(n);
+   for (Int_t i = 0; i < n; ++i) {
+      xy[2 * i] = -5. + 10. * i / n;
+      xy[2 * i + 1] = 0.01 * i;
+   }
+   f.EvalN(n, xy.data(), result.data());
+   for (Int_t i = 0; i < n; ++i)
+      EXPECT_DOUBLE_EQ(f.EvalPar(&xy[2 * i]), result[i]);
+
+   // explicit parameters
+   Double_t params[4] = {1., -1., 0.5, 0.};
+   f.EvalN(n, xy.data(), result.data(), params);
+   for (Int_t i = 0; i < n; ++i)
+      EXPECT_DOUBLE_EQ(f.EvalPar(&xy[2 * i], params), result[i]);
+}
+
+// gradient with respect to the parameters generated with clad
+TEST(TFormula, GradientPar)
+{
+   TFormula f("f_grad", "[0]*x*x + [1]*x/(1+[2]*x)");
+   f.SetParameters(2., 0.5, 0.1);
+#ifdef R__HAS_CLAD
+   ASSERT_TRUE(f.GenerateGradientPar());
+   Double_t x = 1.5;
+   Double_t grad[3];
+   ASSERT_TRUE(f.GradientPar(&x, grad));
+   EXPECT_NEAR(x * x, grad[0], 1e-12);
+   EXPECT_NEAR(x / (1 + 0.1 * x), grad[1], 1e-12);
+   EXPECT_NEAR(-0.5 * x * x / ((1 + 0.1 * x) * (1 + 0.1 * x)), grad[2], 1e-12);
+
+   // the generated gradient agrees with the numerical one of TF1, which is
+   // not replaced by the generated gradient
+   TF1 f1("f1_grad", "[0]*x*x + [1]*x/(1+[2]*x)", 0, 10);
+   f1.SetParameters(2., 0.5, 0.1);
+   ASSERT_TRUE(f1.GetFormula()->GenerateGradientPar());
+   Double_t numGrad[3];
+   f1.GradientPar(&x, numGrad);
+   ASSERT_TRUE(f1.GetFormula()->GradientPar(&x, grad));
+   for (Int_t i = 0; i < 3; ++i)
+      EXPECT_NEAR(numGrad[i], grad[i], 1e-6 * std::abs(grad[i]));
+
+   // the fit wrapper uses the generated gradient only on request, setting to zero the fixed parameters
+   f1.FixParameter(2, 0.1);
+   ROOT::Math::WrappedMultiTF1 wf(f1);
+   EXPECT_FALSE(wf.UseFormulaGradient());
+   wf.SetUseFormulaGradient();
+   wf.ParameterGradient(&x, f1.GetParameters(), grad);
+   EXPECT_NEAR(x * x, grad[0], 1e-12);
+   EXPECT_NEAR(x / (1 + 0.1 * x), grad[1], 1e-12);
+   EXPECT_EQ(0., grad[2]);
+#else
+   EXPECT_FALSE(f.GenerateGradientPar());
+#endif
+}
+
+// a fit with option "G" uses the clad gradient and finds the same minimum as
+// the fit with the numerical derivatives
+TEST(TFormula, GradientFit)
+{
+   TF1 fgen("f_gradgen", "[0]*exp(-0.5*((x-[1])/[2])^2) + [3]", -5, 5);
+   fgen.SetParameters(100., 0.3, 1.2, 5.);
+   TH1D h("h_gradfit", "h", 50, -5, 5);
+   for (Int_t i = 1; i <= h.GetNbinsX(); ++i) {
+      Double_t y = fgen.Eval(h.GetBinCenter(i));
+      h.SetBinContent(i, y);
+      h.SetBinError(i, std::sqrt(y));
+   }
+
+   TF1 f1("f1_gradfit", "[0]*exp(-0.5*((x-[1])/[2])^2) + [3]", -5, 5);
+   f1.SetParameters(80., 0., 1., 1.);
+   TFitResultPtr rNum = h.Fit(&f1, "S Q N 0");
+   ASSERT_EQ(0, (Int_t)rNum);
+   EXPECT_FALSE(f1.GetFormula()->HasGeneratedGradient());
+
+   TF1 f2("f2_gradfit", "[0]*exp(-0.5*((x-[1])/[2])^2) + [3]", -5, 5);
+   f2.SetParameters(80., 0., 1., 1.);
+   TFitResultPtr rGrad = h.Fit(&f2, "S Q N 0 G");
+   ASSERT_EQ(0, (Int_t)rGrad);
+#ifdef R__HAS_CLAD
+   EXPECT_TRUE(f2.GetFormula()->HasGeneratedGradient());
+
+   // at the minimum the generated gradient agrees with the numerical one
+   Double_t x = 0.5;
+   Double_t grad[4], numGrad[4];
+   ASSERT_TRUE(f2.GetFormula()->GradientPar(&x, grad));
+   f2.GradientPar(&x, numGrad);
+   for (Int_t i = 0; i < 4; ++i)
+      EXPECT_NEAR(numGrad[i], grad[i], 1e-4 * (1. + std::abs(grad[i])));
+#endif
+
+   for (Int_t i = 0; i < 4; ++i) {
+      EXPECT_NEAR(fgen.GetParameter(i), rGrad->Parameter(i), 1e-3 * (1. + std::abs(fgen.GetParameter(i))));
+      EXPECT_NEAR(rNum->Parameter(i), rGrad->Parameter(i), 0.05 * rNum->ParError(i));
+   }
+   EXPECT_NEAR(rNum->Chi2(), rGrad->Chi2(), 1e-3);
+}
+
+TEST(TF1, EvalN)
+{
+   TF1 f1("f1_evaln", "gaus(0) + pol1(3)", -5, 5);
+   f1.SetParameters(3., 0.2, 1.1, 0.5, -0.1);
+
+   const Int_t n = 257;
+   std::vector<Double_t> x(n), result(n);
+   for (Int_t i = 0; i < n; ++i)
+      x[i] = -5. + 10. * i / (n - 1);
+   f1.EvalN(n, x.data(), result.data());
+   for (Int_t i = 0; i < n; ++i)
+      EXPECT_DOUBLE_EQ(f1.Eval(x[i]), result[i]);
+
+   // a function which is not a formula is evaluated point by point
+   TF1 f2("f2_evaln", [](double *xx, double *p) { return p[0] * xx[0] * xx[0]; }, -5, 5, 1);
+   f2.SetParameter(0, 2.);
+   f2.EvalN(n, x.data(), result.data());
+   for (Int_t i = 0; i < n; ++i)
+      EXPECT_DOUBLE_EQ(2. * x[i] * x[i], result[i]);
+}
+
+TEST(TF1, EvalNCallers)
+{
+   TF1 f1("f1_callers", "[0]*sin(x) + [1]", 0, 10);
+   f1.SetParameters(2., 1.);
+
+   TH1D h("h_evaln", "h", 100, 0, 10);
+   h.Add(&f1);
+   for (Int_t i = 1; i <= h.GetNbinsX(); ++i)
+      EXPECT_DOUBLE_EQ(f1.Eval(h.GetBinCenter(i)), h.GetBinContent(i));
+
+   TGraph g(50);
+   for (Int_t i = 0; i < 50; ++i)
+      g.SetPoint(i, 0.2 * i, 1.);
+   g.Apply(&f1);
+   for (Int_t i = 0; i < 50; ++i)
+      EXPECT_DOUBLE_EQ(f1.Eval(g.GetX()[i]), g.GetY()[i]);
+
+   // 2-dimensional function: the graph y values are used as second coordinate
+   TF2 f2("f2_callers", "x*y", 0, 10, 0, 10);
+   for (Int_t i = 0; i < 50; ++i)
+      g.SetPoint(i, 0.2 * i, 3.);
+   g.Apply(&f2);
+   for (Int_t i = 0; i < 50; ++i)
+      EXPECT_DOUBLE_EQ(3. * g.GetX()[i], g.GetY()[i]);
+}
@@ -0,0 +1,72 @@
+#include "TGraph2D.h"
+#include "TGraphDelaunay2D.h"
+#include "TH2.h"
+#include "TRandom3.h"
+#include "TROOT.h"
+
+#include "gtest/gtest.h"
+
+#include <memory>
+
+static Double_t Plane(Double_t x, Double_t y)
+{
+   return 2. * x - 3. * y + 1.;
+}
+
+static TGraph2D *MakeGraph(Int_t n)
+{
+   TRandom3 rnd(111);
+   TGraph2D *g = new TGraph2D(n);
+   for (Int_t i = 0; i < n; ++i) {
+      Double_t x = rnd.Uniform(-1., 1.);
+      Double_t y = rnd.Uniform(-1., 1.);
+      g->SetPoint(i, x, y, Plane(x, y));
+   }
+   return g;
+}
+
+// the linear interpolation in the Delaunay triangles is exact for a plane
+TEST(TGraph2D, InterpolatePlane)
+{
+   std::unique_ptr<TGraph2D> g(MakeGraph(20000));
+   TRandom3 rnd(7);
+   for (Int_t i = 0; i < 1000; ++i) {
+      Double_t x = rnd.Uniform(-0.9, 0.9);
+      Double_t y = rnd.Uniform(-0.9, 0.9);
+      EXPECT_NEAR(Plane(x, y), g->Interpolate(x, y), 1.E-9) << "x = " << x << " y = " << y;
+   }
+   // outside the convex hull
+   EXPECT_EQ(0., g->Interpolate(5., 5.));
+}
+
+// the batched (and possibly parallel) interpolation used to fill the histogram
+// must give the same values as the point by point one
+TEST(TGraph2D, HistogramMatchesInterpolate)
+{
+#ifdef R__USE_IMT
+   ROOT::EnableImplicitMT(4);
+#endif
+   std::unique_ptr<TGraph2D> g(MakeGraph(5000));
+   g->SetNpx(100);
+   g->SetNpy(80);
+   TH2D *h = g->GetHistogram();
+   ASSERT_NE(nullptr, h);
+
+   // bin centres computed as in TGraph2D::GetHistogram
+   const Double_t xmin = h->GetXaxis()->GetXmin();
+   const Double_t ymin = h->GetYaxis()->GetXmin();
+   const Double_t dx = (h->GetXaxis()->GetXmax() - xmin) / h->GetNbinsX();
+   const Double_t dy = (h->GetYaxis()->GetXmax() - ymin) / h->GetNbinsY();
+
+   TGraphDelaunay2D dt(g.get());
+   for (Int_t ix = 1; ix <= h->GetNbinsX(); ++ix) {
+      for (Int_t iy = 1; iy <= h->GetNbinsY(); ++iy) {
+         Double_t x = xmin + (ix - 0.5) * dx;
+         Double_t y = ymin + (iy - 0.5) * dy;
+         EXPECT_EQ(dt.ComputeZ(x, y), h->GetBinContent(ix, iy)) << "x = " << x << " y = " << y;
+      }
+   }
+#ifdef R__USE_IMT
+   ROOT::DisableImplicitMT();
+#endif
+}
@@ -0,0 +1,111 @@
+#include "TGraph.h"
+#include "TGraphInterpolator.h"
+#include "TH1.h"
+#include "TMath.h"
+#include "TSpline.h"
+#include "TRandom3.h"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <vector>
+
+// abscissas where the graphs are evaluated: inside, on the points and outside the graph range
+static std::vector<Double_t> EvalPoints(const TGraph &g)
+{
+   std::vector<Double_t> xv;
+   for (Double_t x = -1.; x <= 11.; x += 0.013)
+      xv.push_back(x);
+   for (Int_t i = 0; i < g.GetN(); ++i)
+      xv.push_back(g.GetX()[i]);
+   return xv;
+}
+
+// the interpolator must give the same values as TGraph::Eval on the sorted graph
+static void CompareWithGraph(const TGraph &g, const TGraphInterpolator &interp, Option_t *option)
+{
+   std::vector<Double_t> xv = EvalPoints(g);
+   for (auto x : xv)
+      EXPECT_DOUBLE_EQ(g.Eval(x, nullptr, option), interp.Eval(x)) << "x = " << x;
+
+   // batch evaluation, with unsorted and sorted abscissas
+   std::vector<Double_t> result(xv.size());
+   for (int pass = 0; pass < 2; ++pass) {
+      interp.EvalN(xv.size(), xv.data(), result.data());
+      for (size_t i = 0; i < xv.size(); ++i)
+         EXPECT_EQ(interp.Eval(xv[i]), result[i]) << "x = " << xv[i];
+      std::sort(xv.begin(), xv.end());
+   }
+}
+
+TEST(TGraphInterpolator, Unsorted)
+{
+   TRandom3 rnd(42);
+   TGraph g;
+   for (Int_t i = 0; i < 200; ++i) {
+      Double_t x = rnd.Uniform(0., 10.);
+      g.SetPoint(i, x, TMath::Sin(x) + rnd.Gaus(0., 0.1));
+   }
+   EXPECT_FALSE(TGraphInterpolator(g).IsUniform());
+
+   TGraph sorted(g);
+   sorted.Sort();
+   sorted.SetBit(TGraph::kIsSortedX);
+   CompareWithGraph(sorted, TGraphInterpolator(g), "");
+   CompareWithGraph(sorted, TGraphInterpolator(g, "S"), "S");
+   CompareWithGraph(g, TGraphInterpolator(g, "S"), "S");
+}
+
+TEST(TGraphInterpolator, Uniform)
+{
+   TGraph g;
+   for (Int_t i = 0; i <= 100; ++i)
+      g.SetPoint(i, 0.1 * i, TMath::Exp(-0.1 * i));
+   TGraphInterpolator interp(g);
+   EXPECT_TRUE(interp.IsUniform());
+   CompareWithGraph(g, interp, "");
+   g.SetBit(TGraph::kIsSortedX);
+   CompareWithGraph(g, interp, "");
+   CompareWithGraph(g, TGraphInterpolator(g, "S"), "S");
+}
+
+TEST(TGraphInterpolator, SmallGraphs)
+{
+   TGraph g0;
+   EXPECT_EQ(0., TGraphInterpolator(g0).Eval(1.));
+
+   Double_t x1[] = {1.}, y1[] = {3.};
+   TGraphInterpolator one(1, x1, y1);
+   EXPECT_EQ(3., one.Eval(-5.));
+   Double_t r[2], xv[] = {-5., 5.};
+   one.EvalN(2, xv, r);
+   EXPECT_EQ(3., r[0]);
+   EXPECT_EQ(3., r[1]);
+
+   // points given in decreasing order
+   Double_t x2[] = {2., 1.}, y2[] = {4., 2.};
+   TGraphInterpolator two(2, x2, y2);
+   EXPECT_DOUBLE_EQ(3., two.Eval(1.5));
+   EXPECT_DOUBLE_EQ(6., two.Eval(3.));
+   EXPECT_DOUBLE_EQ(0., two.Eval(0.));
+}
+
+// splines built from equidistant knots given as arbitrary abscissas use the direct knot lookup
+TEST(TSpline3, EquidistantKnots)
+{
+   TH1D h("h", "h", 50, 0., 10.);
+   for (Int_t i = 1; i <= h.GetNbinsX(); ++i)
+      h.SetBinContent(i, TMath::Cos(h.GetBinCenter(i)));
+   TSpline3 s(&h);
+   TSpline3 sgrid("sgrid", h.GetBinCenter(1), h.GetBinCenter(50), h.GetArray() + 1, 50);
+
+   std::vector<Double_t> xv;
+   for (Double_t x = -1.; x <= 11.; x += 0.007)
+      xv.push_back(x);
+   std::vector<Double_t> result(xv.size());
+   s.EvalN(xv.size(), xv.data(), result.data());
+   for (size_t i = 0; i < xv.size(); ++i) {
+      EXPECT_EQ(s.Eval(xv[i]), result[i]) << "x = " << xv[i];
+      EXPECT_NEAR(sgrid.Eval(xv[i]), result[i], 1.E-9) << "x = " << xv[i];
+   }
+}
@@ -0,0 +1,157 @@
+#include "TH2Poly.h"
+#include "TMemFile.h"
+#include "TRandom3.h"
+#include "TROOT.h"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+// Irregular binning: fine squares in one corner, coarse triangles elsewhere
+// and a hole without bins.
+static void AddIrregularBins(TH2Poly &h)
+{
+   for (Int_t i = 0; i < 40; ++i)
+      for (Int_t j = 0; j < 40; ++j)
+         h.AddBin(i * 0.25, j * 0.25, (i + 1) * 0.25, (j + 1) * 0.25);
+   for (Int_t i = 1; i < 10; ++i) {
+      for (Int_t j = 1; j < 10; ++j) {
+         if (i == 5 && j == 5)
+            continue;
+         Double_t x[3] = {i * 10., (i + 1) * 10., i * 10.};
+         Double_t y[3] = {j * 10., j * 10., (j + 1) * 10.};
+         h.AddBin(3, x, y);
+      }
+   }
+}
+
+TEST(TH2Poly, FindBinMatchesBruteForce)
+{
+   TH2Poly h("h", "h", 0., 100., 0., 100.);
+   AddIrregularBins(h);
+
+   TRandom3 rnd(42);
+   for (Int_t i = 0; i < 20000; ++i) {
+      Double_t x = (i % 2) ? rnd.Uniform(0., 10.) : rnd.Uniform(0., 100.);
+      Double_t y = (i % 2) ? rnd.Uniform(0., 10.) : rnd.Uniform(0., 100.);
+      Int_t expected = -5;
+      for (Int_t bin = 1; bin <= h.GetNumberOfBins(); ++bin) {
+         if (h.IsInsideBin(bin, x, y)) {
+            expected = bin;
+            break;
+         }
+      }
+      ASSERT_EQ(expected, h.FindBin(x, y)) << "x=" << x << " y=" << y;
+   }
+
+   EXPECT_EQ(-1, h.FindBin(-1., 101.));
+   EXPECT_EQ(-9, h.FindBin(101., -1.));
+   EXPECT_EQ(-5, h.FindBin(55., 55.));
+}
+
+static void CompareFillNWithFill()
+{
+   TH2Poly h1("h1", "h1", 0., 100., 0., 100.);
+   TH2Poly h2("h2", "h2", 0., 100., 0., 100.);
+   AddIrregularBins(h1);
+   AddIrregularBins(h2);
+
+   const Int_t n = 10000;
+   const Int_t stride = 2;
+   std::vector<Double_t> x(n * stride), y(n * stride), w(n * stride);
+   TRandom3 rnd(7);
+   for (Int_t i = 0; i < n * stride; ++i) {
+      x[i] = rnd.Uniform(-10., 110.);
+      y[i] = rnd.Uniform(-10., 110.);
+      w[i] = rnd.Uniform(0.5, 2.);
+   }
+
+   for (Int_t i = 0; i < n; ++i)
+      h1.Fill(x[i * stride], y[i * stride], w[i * stride]);
+   h2.FillN(n, x.data(), y.data(), w.data(), stride);
+
+   EXPECT_DOUBLE_EQ(h1.GetEntries(), h2.GetEntries());
+   for (Int_t bin = -9; bin <= h1.GetNumberOfBins(); ++bin) {
+      if (bin == 0)
+         continue;
+      EXPECT_DOUBLE_EQ(h1.GetBinContent(bin), h2.GetBinContent(bin)) << "bin " << bin;
+   }
+}
+
+TEST(TH2Poly, FillNMatchesFill)
+{
+   CompareFillNWithFill();
+}
+
+// with implicit MT the bins are looked up in parallel, using the spatial
+// index built before the parallel loop
+TEST(TH2Poly, FillNMatchesFillIMT)
+{
+#ifdef R__USE_IMT
+   ROOT::EnableImplicitMT(4);
+#endif
+   CompareFillNWithFill();
+#ifdef R__USE_IMT
+   ROOT::DisableImplicitMT();
+#endif
+}
+
+// the first lookups from several threads must build the spatial index once
+TEST(TH2Poly, ConcurrentFindBin)
+{
+   TH2Poly h("h", "h", 0., 100., 0., 100.);
+   AddIrregularBins(h);
+   std::atomic<Int_t> nErrors{0};
+   std::vector<std::thread> threads;
+   for (Int_t t = 0; t < 4; ++t) {
+      threads.emplace_back([&h, &nErrors]() {
+         for (Int_t i = 0; i < 40; ++i) {
+            for (Int_t j = 0; j < 40; ++j) {
+               if (h.FindBin(i * 0.25 + 0.1, j * 0.25 + 0.1) != 1 + i * 40 + j)
+                  ++nErrors;
+            }
+         }
+      });
+   }
+   for (auto &t : threads)
+      t.join();
+   EXPECT_EQ(0, nErrors.load());
+}
+
+// reading into an existing histogram replaces its bins: the spatial index
+// built for the old bins must be discarded
+TEST(TH2Poly, ReadIntoExisting)
+{
+   TMemFile file("th2poly_read.root", "RECREATE");
+   {
+      TH2Poly h("h", "h", 0., 10., 0., 10.);
+      h.AddBin(0., 0., 10., 10.);
+      file.WriteTObject(&h);
+   }
+
+   TH2Poly h("h", "h", 0., 10., 0., 10.);
+   h.AddBin(0., 0., 5., 5.);
+   h.AddBin(5., 5., 10., 10.);
+   EXPECT_EQ(2, h.FindBin(6., 6.));
+   EXPECT_EQ(-5, h.FindBin(1., 6.));
+
+   ASSERT_GT(h.Read("h"), 0);
+   EXPECT_EQ(1, h.GetNumberOfBins());
+   EXPECT_EQ(1, h.FindBin(6., 6.));
+   EXPECT_EQ(1, h.FindBin(1., 6.));
+   EXPECT_EQ(1, h.Fill(1., 6.));
+}
+
+TEST(TH2Poly, AddBinAfterFill)
+{
+   TH2Poly h("h", "h", 0., 10., 0., 10.);
+   h.AddBin(0., 0., 5., 5.);
+   EXPECT_EQ(1, h.Fill(1., 1.));
+   EXPECT_EQ(-5, h.Fill(6., 6.));
+
+   h.AddBin(5., 5., 10., 10.);
+   EXPECT_EQ(2, h.Fill(6., 6.));
+   EXPECT_DOUBLE_EQ(1., h.GetBinContent(2));
+}
@@ -0,0 +1,51 @@
+#include "TKDE.h"
+#include "TRandom3.h"
+#include "TROOT.h"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <vector>
+
+static std::vector<Double_t> GenerateData(UInt_t n)
+{
+   TRandom3 rnd(1234);
+   std::vector<Double_t> data(n);
+   for (UInt_t i = 0; i < n; ++i)
+      data[i] = (i % 3) ? rnd.Gaus(0., 1.) : rnd.Exp(2.);
+   return data;
+}
+
+// The exact evaluation summed in parallel must agree with the sequential one.
+TEST(TKDE, ExactParallel)
+{
+   const char *option = "KernelType:Gaussian;Iteration:Fixed;Mirror:noMirror;Binning:Unbinned";
+   std::vector<Double_t> data = GenerateData(100000);
+   TKDE sequential(data.size(), data.data(), -3., 8., option);
+#ifdef R__USE_IMT
+   ROOT::EnableImplicitMT(4);
+#endif
+   TKDE parallel(data.size(), data.data(), -3., 8., option);
+   for (Double_t x = -3.; x <= 8.; x += 0.25)
+      EXPECT_NEAR(sequential(x), parallel(x), 1.E-12 * sequential(x)) << "x = " << x;
+#ifdef R__USE_IMT
+   ROOT::DisableImplicitMT();
+#endif
+}
+
+// The grid evaluation must reproduce the exact one. Without FFTW, the grid is
+// computed with a direct convolution.
+TEST(TKDE, GridFixed)
+{
+   const char *option = "KernelType:Gaussian;Iteration:Fixed;Mirror:noMirror;Binning:Unbinned";
+   std::vector<Double_t> data = GenerateData(5000);
+   TKDE exact(data.size(), data.data(), -3., 8., option);
+   TKDE grid(data.size(), data.data(), -3., 8., option);
+   grid.SetEvaluation(TKDE::kFFT);
+
+   Double_t maxValue = 0.;
+   for (Double_t x = -3.; x <= 8.; x += 0.05)
+      maxValue = std::max(maxValue, exact(x));
+   for (Double_t x = -3.; x <= 8.; x += 0.05)
+      EXPECT_NEAR(exact(x), grid(x), 2.E-3 * maxValue) << "x = " << x;
+}
@@ -0,0 +1,52 @@
+#include "TKDE.h"
+#include "TRandom3.h"
+
+#include "gtest/gtest.h"
+
+#include <vector>
+
+static std::vector<Double_t> GenerateData(UInt_t n)
+{
+   TRandom3 rnd(1234);
+   std::vector<Double_t> data(n);
+   for (UInt_t i = 0; i < n; ++i)
+      data[i] = (i % 3) ? rnd.Gaus(0., 1.) : rnd.Exp(2.);
+   return data;
+}
+
+// The grid evaluation, convolving with FFTW, must reproduce the exact one
+// (the fixed kernel case is tested in test_tkde.cxx, with or without FFTW).
+static void CompareEvaluations(const char *option)
+{
+   std::vector<Double_t> data = GenerateData(5000);
+   TKDE exact(data.size(), data.data(), -3., 8., option);
+   TKDE grid(data.size(), data.data(), -3., 8., option);
+   grid.SetEvaluation(TKDE::kFFT);
+
+   Double_t maxValue = 0.;
+   for (Double_t x = -3.; x <= 8.; x += 0.05)
+      maxValue = std::max(maxValue, exact(x));
+   for (Double_t x = -3.; x <= 8.; x += 0.05)
+      EXPECT_NEAR(exact(x), grid(x), 2.E-3 * maxValue) << "x = " << x;
+}
+
+TEST(TKDE, FFTAdaptive)
+{
+   CompareEvaluations("KernelType:Gaussian;Iteration:Adaptive;Mirror:noMirror;Binning:Unbinned");
+}
+
+TEST(TKDE, FFTMirrorAsym)
+{
+   CompareEvaluations("KernelType:Epanechnikov;Iteration:Fixed;Mirror:MirrorAsymBoth;Binning:Unbinned");
+}
+
+TEST(TKDE, EvaluationOption)
+{
+   std::vector<Double_t> data = GenerateData(1000);
+   TKDE fromOption(data.size(), data.data(), -3., 8.,
+                   "KernelType:Gaussian;Iteration:Fixed;Binning:Unbinned;Evaluation:FFT");
+   TKDE fromSetter(data.size(), data.data(), -3., 8., "KernelType:Gaussian;Iteration:Fixed;Binning:Unbinned");
+   fromSetter.SetEvaluation(TKDE::kFFT);
+   for (Double_t x = -3.; x <= 8.; x += 0.5)
+      EXPECT_DOUBLE_EQ(fromSetter(x), fromOption(x));
+}
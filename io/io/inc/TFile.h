@@ -30,7 +30,9 @@
 #ifdef R__USE_IMT
 #include "ROOT/TRWSpinLock.hxx"
 #include "ROOT/RConcurrentHashColl.hxx"
+#include <map>
 #include <mutex>
+#include <thread>
 #endif
 
 
@@ -47,6 +49,7 @@ class TFilePrefetch;
 class TFile : public TDirectoryFile {
   friend class TDirectoryFile;
   friend class TFilePrefetch;
+  friend class TFileCacheWrite;
 // TODO: We need to make sure only one TBasket is being written at a time
 // if we are writing multiple baskets in parallel.
 #ifdef R__USE_IMT
@@ -99,6 +102,8 @@ protected:
    Bool_t           fInitDone : 1;   ///<!True if the file has been initialized
    Bool_t           fMustFlush : 1;  ///<!True if the file buffers must be flushed
    Bool_t           fIsPcmFile : 1;  ///<!True if the file is a ROOT pcm file.
+   Bool_t           fPositionedRead : 1; ///<!True if fD is a local file descriptor supporting positioned reads (pread)
+   Bool_t           fSharedRead : 1; ///<!True if the file is read by several threads at once (see SetSharedRead())
    TFileOpenHandle *fAsyncHandle;    ///<!For proper automatic cleanup
    EAsyncOpenStatus fAsyncOpenStatus; ///<!Status of an asynchronous open request
    TUrl             fUrl;            ///<!URL of file
@@ -110,6 +115,8 @@ protected:
    static ROOT::TRWSpinLock                   fgRwLock;     ///<!Read-write lock to protect global PID list
    std::mutex                                 fWriteMutex;  ///<!Lock for writing baskets / keys into the file.
    static ROOT::Internal::RConcurrentHashColl fgTsSIHashes; ///<!TS Set of hashes built from read streamer infos
+   mutable std::mutex                         fSharedReadMutex; ///<!Lock for the read caches and statistics in shared read mode
+   std::map<std::thread::id, TFileCacheRead *> fThreadCacheRead; ///<!Read cache of each thread in shared read mode
 #endif
 
    static TList    *fgAsyncOpenRequests; //List of handles for pending open requests
@@ -130,6 +137,9 @@ protected:
    virtual void  Init(Bool_t create);
    Bool_t                    FlushWriteCache();
    Int_t                     ReadBufferViaCache(char *buf, Int_t len);
+   Int_t                     ReadBufferViaCache(char *buf, Long64_t pos, Int_t len);
+   Bool_t                    ReadBufferPositioned(char *buf, Long64_t pos, Int_t len);
+   TFileCacheRead           *GetCurrentCacheRead() const;
    Int_t                     WriteBufferViaCache(const char *buf, Int_t len);
    std::pair<TList *, Int_t> GetStreamerInfoListImpl(bool readSI);
 
@@ -233,6 +243,8 @@ public:
            Bool_t      IsBinary() const { return TestBit(kBinaryFile); }
            Bool_t      IsRaw() const { return !fIsRootFile; }
    virtual Bool_t      IsOpen() const;
+           Bool_t      IsPositionedRead() const { return fPositionedRead && !fWritable; }
+           Bool_t      IsSharedRead() const { return fSharedRead; }
    virtual void        ls(Option_t *option="") const;
    virtual void        MakeFree(Long64_t first, Long64_t last);
    virtual void        MakeProject(const char *dirname, const char *classes="*",
@@ -262,6 +274,7 @@ public:
    virtual void        SetOffset(Long64_t offset, ERelativeTo pos = kBeg);
    virtual void        SetOption(Option_t *option=">") { fOption = option; }
    virtual void        SetReadCalls(Int_t readcalls = 0) { fReadCalls = readcalls; }
+           Bool_t      SetSharedRead(Bool_t shared = kTRUE);
    virtual void        ShowStreamerInfo();
    virtual Int_t       Sizeof() const;
    void                SumBuffer(Int_t bufsize);
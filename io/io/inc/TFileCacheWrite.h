@@ -16,6 +16,12 @@
 
 class TFile;
 
+namespace ROOT {
+namespace Internal {
+class TWriteBehindQueue;
+}
+}
+
 class TFileCacheWrite : public TObject {
 
 protected:
@@ -25,6 +31,7 @@ protected:
    TFile        *fFile;           ///< Pointer to file
    char         *fBuffer;         ///< [fBufferSize] buffer of contiguous prefetched blocks
    Bool_t        fRecursive;      ///< flag to avoid recursive calls
+   ROOT::Internal::TWriteBehindQueue *fWriteBehind; ///<! Background writer, if write-behind is enabled
 
 private:
    TFileCacheWrite(const TFileCacheWrite &);            //cannot be copied
@@ -34,12 +41,15 @@ public:
    TFileCacheWrite();
    TFileCacheWrite(TFile *file, Int_t buffersize);
    virtual ~TFileCacheWrite();
+   virtual Bool_t      EnableWriteBehind(Int_t maxPending = 4);
    virtual Bool_t      Flush();
    virtual Int_t       GetBytesInCache() const { return fNtot; }
    virtual void        Print(Option_t *option="") const;
    virtual Int_t       ReadBuffer(char *buf, Long64_t pos, Int_t len);
    virtual Int_t       WriteBuffer(const char *buf, Long64_t pos, Int_t len);
    virtual void        SetFile(TFile *file);
+   virtual Bool_t      Sync();
+   Bool_t              IsWriteBehind() const { return fWriteBehind != nullptr; }
 
    ClassDef(TFileCacheWrite,1)  //TFile cache when writing
 };
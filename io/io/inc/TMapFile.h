@@ -44,7 +44,7 @@ private:
    Bool_t      fWritable;       ///< TRUE if mapped file opened in RDWR mode
    Int_t       fSemaphore;      ///< Modification semaphore (or getpid() for WIN32)
    ULong_t     fhSemaphore;     ///< HANDLE of WIN32 Mutex object to implement semaphore
-   TObject    *fGetting;        ///< Don't deadlock in update mode, when from Get() Add() is called
+   TObject    *fGetting;        ///< Not used anymore, kept for the layout of the mapped TMapFile
    Int_t       fWritten;        ///< Number of objects written sofar
    Double_t    fSumBuffer;      ///< Sum of buffer sizes of objects written sofar
    Double_t    fSum2Buffer;     ///< Sum of squares of buffer sizes of objects written so far
@@ -105,6 +105,7 @@ public:
    TObject      *Remove(const char *name) { return Remove(name, kTRUE); }
    void          RemoveAll();
    TObject      *Get(const char *name, TObject *retObj = 0);
+   Int_t         GetUpdateCount(const char *name);
 
    static TMapFile *Create(const char *name, Option_t *option="READ", Int_t size=kDefaultMapSize, const char *title="");
    static TMapFile *WhichMapFile(void *addr);
@@ -135,6 +136,7 @@ private:
    TObject         *fObject;     ///< Pointer to original object
    void            *fBuffer;     ///< Buffer containing object of class name
    Int_t            fBufSize;    ///< Buffer size
+   Int_t            fUpdates;    ///< Number of times the buffer was updated
    TMapRec         *fNext;       ///< Next MapRec in list
 
    TMapRec(const TMapRec&);            // Not implemented.
@@ -147,6 +149,7 @@ public:
    const char   *GetClassName(Long_t offset = 0) const { return (char *)((Long_t) fClassName + offset); }
    void         *GetBuffer(Long_t offset = 0) const { return (void *)((Long_t) fBuffer + offset); }
    Int_t         GetBufSize() const { return fBufSize; }
+   Int_t         GetUpdateCount() const { return fUpdates; }
    TObject      *GetObject() const;
    TMapRec      *GetNext(Long_t offset = 0) const { return (TMapRec *)((Long_t) fNext + offset); }
 };
@@ -0,0 +1,77 @@
+// @(#)root/io:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2018, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_ReadConvertFastArray
+#define ROOT_ReadConvertFastArray
+
+//////////////////////////////////////////////////////////////////////////
+//                                                                      //
+// ReadConvertFastArray                                                 //
+//                                                                      //
+// Helpers used when reading a collection of numbers whose type on file //
+// differs from the in-memory type (for example std::vector<float>      //
+// read into std::vector<double>).  The on-file values are read in one  //
+// go into a temporary array (on the stack for small collections) and   //
+// then converted with a plain loop over contiguous storage which the   //
+// compiler can vectorize.                                              //
+//                                                                      //
+//////////////////////////////////////////////////////////////////////////
+
+#include "RtypesCore.h"
+
+#include <memory>
+#include <vector>
+
+namespace ROOT {
+namespace Internal {
+
+/// Read `nvalues` values of type `From` with `read(From *, Int_t)` and store
+/// them, converted, into the contiguous array `dest`.
+template <typename From, typename To, typename Reader>
+inline void ReadConvertFastArray(To *dest, Int_t nvalues, Reader &&read)
+{
+   constexpr Int_t kOnStack = 256;
+   From onstack[kOnStack];
+   std::unique_ptr<From[]> onheap;
+   From *temp = onstack;
+   if (nvalues > kOnStack) {
+      onheap.reset(new From[nvalues]);
+      temp = onheap.get();
+   }
+   read(temp, nvalues);
+   for (Int_t ind = 0; ind < nvalues; ++ind)
+      dest[ind] = (To)temp[ind];
+}
+
+/// Same as above for an already resized std::vector.
+template <typename From, typename To, typename Reader>
+inline void ReadConvertFastArray(std::vector<To> &vec, Int_t nvalues, Reader &&read)
+{
+   if (nvalues <= 0)
+      return;
+   ReadConvertFastArray<From>(vec.data(), nvalues, read);
+}
+
+/// std::vector<bool> has no contiguous storage, convert element by element.
+template <typename From, typename Reader>
+inline void ReadConvertFastArray(std::vector<bool> &vec, Int_t nvalues, Reader &&read)
+{
+   if (nvalues <= 0)
+      return;
+   std::unique_ptr<From[]> temp(new From[nvalues]);
+   read(temp.get(), nvalues);
+   for (Int_t ind = 0; ind < nvalues; ++ind)
+      vec[ind] = (bool)temp[ind];
+}
+
+} // namespace Internal
+} // namespace ROOT
+
+#endif
@@ -35,6 +35,7 @@ The concrete implementation of TBuffer for writing/reading to/from a ROOT file o
 #include "TInterpreter.h"
 #include "TVirtualMutex.h"
 #include "TROOT.h"
+#include "ReadConvertFastArray.h"
 
 #if (defined(__linux) || defined(__APPLE__)) && defined(__i386__) && \
      defined(__GNUC__)
@@ -69,6 +70,106 @@ static inline bool Class_Has_StreamerInfo(const TClass* cl)
    return cl->GetStreamerInfos()->GetLast()>1;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Pack n values as UInt_t computed with a range and scaling factor (see
+/// TBufferFile::WriteFloat16).  The values are stored big-endian byte by byte,
+/// which keeps the loop free of per-element calls and lets it vectorize.
+
+template <typename T>
+static inline void PackWithFactor(char *&buf, const T *in, Int_t n, Double_t factor, Double_t xmin, Double_t xmax)
+{
+   UChar_t *b = (UChar_t *)buf;
+   for (Int_t j = 0; j < n; ++j, b += 4) {
+      T x = in[j];
+      if (x < xmin) x = xmin;
+      if (x > xmax) x = xmax;
+      UInt_t aint = UInt_t(0.5+factor*(x-xmin));
+      b[0] = (UChar_t)(aint >> 24);
+      b[1] = (UChar_t)(aint >> 16);
+      b[2] = (UChar_t)(aint >> 8);
+      b[3] = (UChar_t)aint;
+   }
+   buf = (char *)b;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Unpack n values written by PackWithFactor.
+
+template <typename T>
+static inline void UnpackWithFactor(char *&buf, T *out, Int_t n, Double_t factor, Double_t xmin)
+{
+   const UChar_t *b = (const UChar_t *)buf;
+   for (Int_t j = 0; j < n; ++j, b += 4) {
+      UInt_t aint = (UInt_t(b[0]) << 24) | (UInt_t(b[1]) << 16) | (UInt_t(b[2]) << 8) | UInt_t(b[3]);
+      out[j] = (T)(aint/factor + xmin);
+   }
+   buf = (char *)b;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Pack n values converted to Float_t (see TBufferFile::WriteDouble32).
+
+template <typename T>
+static inline void PackAsFloats(char *&buf, const T *in, Int_t n)
+{
+   UChar_t *b = (UChar_t *)buf;
+   for (Int_t i = 0; i < n; ++i, b += 4) {
+      Float_t x = (Float_t)in[i];
+      UInt_t bits;
+      memcpy(&bits, &x, sizeof(bits));
+      b[0] = (UChar_t)(bits >> 24);
+      b[1] = (UChar_t)(bits >> 16);
+      b[2] = (UChar_t)(bits >> 8);
+      b[3] = (UChar_t)bits;
+   }
+   buf = (char *)b;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Pack n values as floats whose mantissa is truncated to nbits: the exponent
+/// is stored as a UChar_t and the mantissa (plus sign) as a UShort_t (see
+/// TBufferFile::WriteFloat16).
+
+template <typename T>
+static inline void PackTruncatedFloats(char *&buf, const T *in, Int_t n, Int_t nbits)
+{
+   UChar_t *b = (UChar_t *)buf;
+   for (Int_t i = 0; i < n; ++i, b += 3) {
+      Float_t x = (Float_t)in[i];
+      UInt_t bits;
+      memcpy(&bits, &x, sizeof(bits));
+      UShort_t theMan = ((1<<(nbits+1))-1) & (bits>>(23-nbits-1));
+      theMan++;
+      theMan = theMan>>1;
+      if (theMan&1<<nbits) theMan = (1<<nbits) - 1;
+      if (x < 0) theMan |= 1<<(nbits+1);
+      b[0] = (UChar_t)(bits >> 23);
+      b[1] = (UChar_t)(theMan >> 8);
+      b[2] = (UChar_t)theMan;
+   }
+   buf = (char *)b;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Unpack n values written by PackTruncatedFloats.
+
+template <typename T>
+static inline void UnpackTruncatedFloats(char *&buf, T *out, Int_t n, Int_t nbits)
+{
+   const UInt_t manMask = (1u << (nbits+1)) - 1;
+   const UInt_t signBit = 1u << (nbits+1);
+   const UChar_t *b = (const UChar_t *)buf;
+   for (Int_t i = 0; i < n; ++i, b += 3) {
+      UInt_t theMan = (UInt_t(b[1]) << 8) | UInt_t(b[2]);
+      UInt_t bits = (UInt_t(b[0]) << 23) | ((theMan & manMask) << (23-nbits));
+      if (theMan & signBit) bits |= 0x80000000u;
+      Float_t x;
+      memcpy(&x, &bits, sizeof(x));
+      out[i] = (T)x;
+   }
+   buf = (char *)b;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Create an I/O buffer object. Mode should be either TBuffer::kRead or
 /// TBuffer::kWrite. By default the I/O buffer has a size of
@@ -766,8 +867,7 @@ Int_t TBufferFile::ReadArray(Short_t *&h)
    bswapcpy16(h, fBufCur, n);
    fBufCur += l;
 # else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &h[i]);
+   frombuf(fBufCur, h, n);
 # endif
 #else
    memcpy(h, fBufCur, l);
@@ -799,8 +899,7 @@ Int_t TBufferFile::ReadArray(Int_t *&ii)
    bswapcpy32(ii, fBufCur, n);
    fBufCur += l;
 # else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &ii[i]);
+   frombuf(fBufCur, ii, n);
 # endif
 #else
    memcpy(ii, fBufCur, l);
@@ -854,8 +953,7 @@ Int_t TBufferFile::ReadArray(Long64_t *&ll)
    if (!ll) ll = new Long64_t[n];
 
 #ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &ll[i]);
+   frombuf(fBufCur, ll, n);
 #else
    memcpy(ll, fBufCur, l);
    fBufCur += l;
@@ -886,8 +984,7 @@ Int_t TBufferFile::ReadArray(Float_t *&f)
    bswapcpy32(f, fBufCur, n);
    fBufCur += l;
 # else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &f[i]);
+   frombuf(fBufCur, f, n);
 # endif
 #else
    memcpy(f, fBufCur, l);
@@ -915,8 +1012,7 @@ Int_t TBufferFile::ReadArray(Double_t *&d)
    if (!d) d = new Double_t[n];
 
 #ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &d[i]);
+   frombuf(fBufCur, d, n);
 #else
    memcpy(d, fBufCur, l);
    fBufCur += l;
@@ -1039,8 +1135,7 @@ Int_t TBufferFile::ReadStaticArray(Short_t *h)
    bswapcpy16(h, fBufCur, n);
    fBufCur += l;
 # else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &h[i]);
+   frombuf(fBufCur, h, n);
 # endif
 #else
    memcpy(h, fBufCur, l);
@@ -1071,8 +1166,7 @@ Int_t TBufferFile::ReadStaticArray(Int_t *ii)
    bswapcpy32(ii, fBufCur, n);
    fBufCur += sizeof(Int_t)*n;
 # else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &ii[i]);
+   frombuf(fBufCur, ii, n);
 # endif
 #else
    memcpy(ii, fBufCur, l);
@@ -1124,8 +1218,7 @@ Int_t TBufferFile::ReadStaticArray(Long64_t *ll)
    if (!ll) return 0;
 
 #ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &ll[i]);
+   frombuf(fBufCur, ll, n);
 #else
    memcpy(ll, fBufCur, l);
    fBufCur += l;
@@ -1155,8 +1248,7 @@ Int_t TBufferFile::ReadStaticArray(Float_t *f)
    bswapcpy32(f, fBufCur, n);
    fBufCur += sizeof(Float_t)*n;
 # else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &f[i]);
+   frombuf(fBufCur, f, n);
 # endif
 #else
    memcpy(f, fBufCur, l);
@@ -1183,8 +1275,7 @@ Int_t TBufferFile::ReadStaticArray(Double_t *d)
    if (!d) return 0;
 
 #ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &d[i]);
+   frombuf(fBufCur, d, n);
 #else
    memcpy(d, fBufCur, l);
    fBufCur += l;
@@ -1305,8 +1396,7 @@ void TBufferFile::ReadFastArray(Short_t *h, Int_t n)
    bswapcpy16(h, fBufCur, n);
    fBufCur += sizeof(Short_t)*n;
 # else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &h[i]);
+   frombuf(fBufCur, h, n);
 # endif
 #else
    memcpy(h, fBufCur, l);
@@ -1327,8 +1417,7 @@ void TBufferFile::ReadFastArray(Int_t *ii, Int_t n)
    bswapcpy32(ii, fBufCur, n);
    fBufCur += sizeof(Int_t)*n;
 # else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &ii[i]);
+   frombuf(fBufCur, ii, n);
 # endif
 #else
    memcpy(ii, fBufCur, l);
@@ -1361,8 +1450,7 @@ void TBufferFile::ReadFastArray(Long64_t *ll, Int_t n)
    if (l <= 0 || l > fBufSize) return;
 
 #ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &ll[i]);
+   frombuf(fBufCur, ll, n);
 #else
    memcpy(ll, fBufCur, l);
    fBufCur += l;
@@ -1382,8 +1470,7 @@ void TBufferFile::ReadFastArray(Float_t *f, Int_t n)
    bswapcpy32(f, fBufCur, n);
    fBufCur += sizeof(Float_t)*n;
 # else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &f[i]);
+   frombuf(fBufCur, f, n);
 # endif
 #else
    memcpy(f, fBufCur, l);
@@ -1400,8 +1487,7 @@ void TBufferFile::ReadFastArray(Double_t *d, Int_t n)
    if (l <= 0 || l > fBufSize) return;
 
 #ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &d[i]);
+   frombuf(fBufCur, d, n);
 #else
    memcpy(d, fBufCur, l);
    fBufCur += l;
@@ -1418,33 +1504,14 @@ void TBufferFile::ReadFastArrayFloat16(Float_t *f, Int_t n, TStreamerElement *el
 
    if (ele && ele->GetFactor() != 0) {
       //a range was specified. We read an integer and convert it back to a float
-      Double_t xmin = ele->GetXmin();
-      Double_t factor = ele->GetFactor();
-      for (int j=0;j < n; j++) {
-         UInt_t aint; *this >> aint; f[j] = (Float_t)(aint/factor + xmin);
-      }
+      UnpackWithFactor(fBufCur, f, n, ele->GetFactor(), ele->GetXmin());
    } else {
-      Int_t i;
       Int_t nbits = 0;
       if (ele) nbits = (Int_t)ele->GetXmin();
       if (!nbits) nbits = 12;
       //we read the exponent and the truncated mantissa of the float
       //and rebuild the new float.
-      union {
-         Float_t fFloatValue;
-         Int_t   fIntValue;
-      };
-      UChar_t  theExp;
-      UShort_t theMan;
-      for (i = 0; i < n; i++) {
-         *this >> theExp;
-         *this >> theMan;
-         fIntValue = theExp;
-         fIntValue <<= 23;
-         fIntValue |= (theMan & ((1<<(nbits+1))-1)) <<(23-nbits);
-         if(1<<(nbits+1) & theMan) fFloatValue = -fFloatValue;
-         f[i] = fFloatValue;
-      }
+      UnpackTruncatedFloats(fBufCur, f, n, nbits);
    }
 }
 
@@ -1457,9 +1524,7 @@ void TBufferFile::ReadFastArrayWithFactor(Float_t *ptr, Int_t n, Double_t factor
    if (n <= 0 || 3*n > fBufSize) return;
 
    //a range was specified. We read an integer and convert it back to a float
-   for (int j=0;j < n; j++) {
-      UInt_t aint; *this >> aint; ptr[j] = (Float_t)(aint/factor + minvalue);
-   }
+   UnpackWithFactor(fBufCur, ptr, n, factor, minvalue);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1473,21 +1538,7 @@ void TBufferFile::ReadFastArrayWithNbits(Float_t *ptr, Int_t n, Int_t nbits)
    if (!nbits) nbits = 12;
    //we read the exponent and the truncated mantissa of the float
    //and rebuild the new float.
-   union {
-      Float_t fFloatValue;
-      Int_t   fIntValue;
-   };
-   UChar_t  theExp;
-   UShort_t theMan;
-   for (Int_t i = 0; i < n; i++) {
-      *this >> theExp;
-      *this >> theMan;
-      fIntValue = theExp;
-      fIntValue <<= 23;
-      fIntValue |= (theMan & ((1<<(nbits+1))-1)) <<(23-nbits);
-      if(1<<(nbits+1) & theMan) fFloatValue = -fFloatValue;
-      ptr[i] = fFloatValue;
-   }
+   UnpackTruncatedFloats(fBufCur, ptr, n, nbits);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1500,40 +1551,17 @@ void TBufferFile::ReadFastArrayDouble32(Double_t *d, Int_t n, TStreamerElement *
 
    if (ele && ele->GetFactor() != 0) {
       //a range was specified. We read an integer and convert it back to a double.
-      Double_t xmin = ele->GetXmin();
-      Double_t factor = ele->GetFactor();
-      for (int j=0;j < n; j++) {
-         UInt_t aint; *this >> aint; d[j] = (Double_t)(aint/factor + xmin);
-      }
+      UnpackWithFactor(fBufCur, d, n, ele->GetFactor(), ele->GetXmin());
    } else {
-      Int_t i;
       Int_t nbits = 0;
       if (ele) nbits = (Int_t)ele->GetXmin();
       if (!nbits) {
          //we read a float and convert it to double
-         Float_t afloat;
-         for (i = 0; i < n; i++) {
-            *this >> afloat;
-            d[i] = (Double_t)afloat;
-         }
+         ROOT::Internal::ReadConvertFastArray<Float_t>(d, n, [this](Float_t *f, Int_t nf) { frombuf(fBufCur, f, nf); });
       } else {
          //we read the exponent and the truncated mantissa of the float
          //and rebuild the double.
-         union {
-            Float_t fFloatValue;
-            Int_t   fIntValue;
-         };
-         UChar_t  theExp;
-         UShort_t theMan;
-         for (i = 0; i < n; i++) {
-            *this >> theExp;
-            *this >> theMan;
-            fIntValue = theExp;
-            fIntValue <<= 23;
-            fIntValue |= (theMan & ((1<<(nbits+1))-1)) <<(23-nbits);
-            if (1<<(nbits+1) & theMan) fFloatValue = -fFloatValue;
-            d[i] = (Double_t)fFloatValue;
-         }
+         UnpackTruncatedFloats(fBufCur, d, n, nbits);
       }
    }
 }
@@ -1547,9 +1575,7 @@ void TBufferFile::ReadFastArrayWithFactor(Double_t *d, Int_t n, Double_t factor,
    if (n <= 0 || 3*n > fBufSize) return;
 
    //a range was specified. We read an integer and convert it back to a double.
-   for (int j=0;j < n; j++) {
-      UInt_t aint; *this >> aint; d[j] = (Double_t)(aint/factor + minvalue);
-   }
+   UnpackWithFactor(fBufCur, d, n, factor, minvalue);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1562,29 +1588,11 @@ void TBufferFile::ReadFastArrayWithNbits(Double_t *d, Int_t n, Int_t nbits)
 
    if (!nbits) {
       //we read a float and convert it to double
-      Float_t afloat;
-      for (Int_t i = 0; i < n; i++) {
-         *this >> afloat;
-         d[i] = (Double_t)afloat;
-      }
+      ROOT::Internal::ReadConvertFastArray<Float_t>(d, n, [this](Float_t *f, Int_t nf) { frombuf(fBufCur, f, nf); });
    } else {
       //we read the exponent and the truncated mantissa of the float
       //and rebuild the double.
-      union {
-         Float_t fFloatValue;
-         Int_t   fIntValue;
-      };
-      UChar_t  theExp;
-      UShort_t theMan;
-      for (Int_t i = 0; i < n; i++) {
-         *this >> theExp;
-         *this >> theMan;
-         fIntValue = theExp;
-         fIntValue <<= 23;
-         fIntValue |= (theMan & ((1<<(nbits+1))-1)) <<(23-nbits);
-         if (1<<(nbits+1) & theMan) fFloatValue = -fFloatValue;
-         d[i] = (Double_t)fFloatValue;
-      }
+      UnpackTruncatedFloats(fBufCur, d, n, nbits);
    }
 }
 
@@ -1738,8 +1746,7 @@ void TBufferFile::WriteArray(const Short_t *h, Int_t n)
    bswapcpy16(fBufCur, h, n);
    fBufCur += l;
 # else
-   for (int i = 0; i < n; i++)
-      tobuf(fBufCur, h[i]);
+   tobuf(fBufCur, h, n);
 # endif
 #else
    memcpy(fBufCur, h, l);
@@ -1768,8 +1775,7 @@ void TBufferFile::WriteArray(const Int_t *ii, Int_t n)
    bswapcpy32(fBufCur, ii, n);
    fBufCur += l;
 # else
-   for (int i = 0; i < n; i++)
-      tobuf(fBufCur, ii[i]);
+   tobuf(fBufCur, ii, n);
 # endif
 #else
    memcpy(fBufCur, ii, l);
@@ -1832,8 +1838,7 @@ void TBufferFile::WriteArray(const Long64_t *ll, Int_t n)
    if (fBufCur + l > fBufMax) AutoExpand(fBufSize+l);
 
 #ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      tobuf(fBufCur, ll[i]);
+   tobuf(fBufCur, ll, n);
 #else
    memcpy(fBufCur, ll, l);
    fBufCur += l;
@@ -1861,8 +1866,7 @@ void TBufferFile::WriteArray(const Float_t *f, Int_t n)
    bswapcpy32(fBufCur, f, n);
    fBufCur += l;
 # else
-   for (int i = 0; i < n; i++)
-      tobuf(fBufCur, f[i]);
+   tobuf(fBufCur, f, n);
 # endif
 #else
    memcpy(fBufCur, f, l);
@@ -1887,8 +1891,7 @@ void TBufferFile::WriteArray(const Double_t *d, Int_t n)
    if (fBufCur + l > fBufMax) AutoExpand(fBufSize+l);
 
 #ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      tobuf(fBufCur, d[i]);
+   tobuf(fBufCur, d, n);
 #else
    memcpy(fBufCur, d, l);
    fBufCur += l;
@@ -2004,8 +2007,7 @@ void TBufferFile::WriteFastArray(const Short_t *h, Int_t n)
    bswapcpy16(fBufCur, h, n);
    fBufCur += l;
 # else
-   for (int i = 0; i < n; i++)
-      tobuf(fBufCur, h[i]);
+   tobuf(fBufCur, h, n);
 # endif
 #else
    memcpy(fBufCur, h, l);
@@ -2028,8 +2030,7 @@ void TBufferFile::WriteFastArray(const Int_t *ii, Int_t n)
    bswapcpy32(fBufCur, ii, n);
    fBufCur += l;
 # else
-   for (int i = 0; i < n; i++)
-      tobuf(fBufCur, ii[i]);
+   tobuf(fBufCur, ii, n);
 # endif
 #else
    memcpy(fBufCur, ii, l);
@@ -2076,8 +2077,7 @@ void TBufferFile::WriteFastArray(const Long64_t *ll, Int_t n)
    if (fBufCur + l > fBufMax) AutoExpand(fBufSize+l);
 
 #ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      tobuf(fBufCur, ll[i]);
+   tobuf(fBufCur, ll, n);
 #else
    memcpy(fBufCur, ll, l);
    fBufCur += l;
@@ -2099,8 +2099,7 @@ void TBufferFile::WriteFastArray(const Float_t *f, Int_t n)
    bswapcpy32(fBufCur, f, n);
    fBufCur += l;
 # else
-   for (int i = 0; i < n; i++)
-      tobuf(fBufCur, f[i]);
+   tobuf(fBufCur, f, n);
 # endif
 #else
    memcpy(fBufCur, f, l);
@@ -2119,8 +2118,7 @@ void TBufferFile::WriteFastArray(const Double_t *d, Int_t n)
    if (fBufCur + l > fBufMax) AutoExpand(fBufSize+l);
 
 #ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      tobuf(fBufCur, d[i]);
+   tobuf(fBufCur, d, n);
 #else
    memcpy(fBufCur, d, l);
    fBufCur += l;
@@ -2142,39 +2140,16 @@ void TBufferFile::WriteFastArrayFloat16(const Float_t *f, Int_t n, TStreamerElem
       //A range is specified. We normalize the float to the range and
       //convert it to an integer using a scaling factor that is a function of nbits.
       //see TStreamerElement::GetRange.
-      Double_t factor = ele->GetFactor();
-      Double_t xmin = ele->GetXmin();
-      Double_t xmax = ele->GetXmax();
-      for (int j = 0; j < n; j++) {
-         Float_t x = f[j];
-         if (x < xmin) x = xmin;
-         if (x > xmax) x = xmax;
-         UInt_t aint = UInt_t(0.5+factor*(x-xmin)); *this << aint;
-      }
+      PackWithFactor(fBufCur, f, n, ele->GetFactor(), ele->GetXmin(), ele->GetXmax());
    } else {
       Int_t nbits = 0;
       //number of bits stored in fXmin (see TStreamerElement::GetRange)
       if (ele) nbits = (Int_t)ele->GetXmin();
       if (!nbits) nbits = 12;
-      Int_t i;
       //a range is not specified, but nbits is.
       //In this case we truncate the mantissa to nbits and we stream
       //the exponent as a UChar_t and the mantissa as a UShort_t.
-      union {
-         Float_t fFloatValue;
-         Int_t   fIntValue;
-      };
-      for (i = 0; i < n; i++) {
-         fFloatValue = f[i];
-         UChar_t  theExp = (UChar_t)(0x000000ff & ((fIntValue<<1)>>24));
-         UShort_t theMan = ((1<<(nbits+1))-1) & (fIntValue>>(23-nbits-1));
-         theMan++;
-         theMan = theMan>>1;
-         if (theMan&1<<nbits) theMan = (1<<nbits) - 1;
-         if (fFloatValue < 0) theMan |= 1<<(nbits+1);
-         *this << theExp;
-         *this << theMan;
-      }
+      PackTruncatedFloats(fBufCur, f, n, nbits);
    }
 }
 
@@ -2193,45 +2168,19 @@ void TBufferFile::WriteFastArrayDouble32(const Double_t *d, Int_t n, TStreamerEl
       //A range is specified. We normalize the double to the range and
       //convert it to an integer using a scaling factor that is a function of nbits.
       //see TStreamerElement::GetRange.
-      Double_t factor = ele->GetFactor();
-      Double_t xmin = ele->GetXmin();
-      Double_t xmax = ele->GetXmax();
-      for (int j = 0; j < n; j++) {
-         Double_t x = d[j];
-         if (x < xmin) x = xmin;
-         if (x > xmax) x = xmax;
-         UInt_t aint = UInt_t(0.5+factor*(x-xmin)); *this << aint;
-      }
+      PackWithFactor(fBufCur, d, n, ele->GetFactor(), ele->GetXmin(), ele->GetXmax());
    } else {
       Int_t nbits = 0;
       //number of bits stored in fXmin (see TStreamerElement::GetRange)
       if (ele) nbits = (Int_t)ele->GetXmin();
-      Int_t i;
       if (!nbits) {
          //if no range and no bits specified, we convert from double to float
-         for (i = 0; i < n; i++) {
-            Float_t afloat = (Float_t)d[i];
-            *this << afloat;
-         }
+         PackAsFloats(fBufCur, d, n);
       } else {
          //a range is not specified, but nbits is.
          //In this case we truncate the mantissa to nbits and we stream
          //the exponent as a UChar_t and the mantissa as a UShort_t.
-         union {
-            Float_t fFloatValue;
-            Int_t   fIntValue;
-         };
-         for (i = 0; i < n; i++) {
-            fFloatValue = (Float_t)d[i];
-            UChar_t  theExp = (UChar_t)(0x000000ff & ((fIntValue<<1)>>24));
-            UShort_t theMan = ((1<<(nbits+1))-1) & (fIntValue>>(23-nbits-1));
-            theMan++;
-            theMan = theMan>>1;
-            if(theMan&1<<nbits) theMan = (1<<nbits) - 1;
-            if (fFloatValue < 0) theMan |= 1<<(nbits+1);
-            *this << theExp;
-            *this << theMan;
-         }
+         PackTruncatedFloats(fBufCur, d, n, nbits);
       }
    }
 }
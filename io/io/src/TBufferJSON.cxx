@@ -49,10 +49,14 @@ persistent storage for object data - only for live applications.
 #include <string.h>
 #include <locale.h>
 #include <cmath>
+#include <vector>
+#include <algorithm>
+#include <type_traits>
 
 #include "Compression.h"
 
 #include "TArrayI.h"
+#include "TBase64.h"
 #include "TObjArray.h"
 #include "TError.h"
 #include "TROOT.h"
@@ -407,8 +411,12 @@ TBufferJSON::~TBufferJSON()
 ///  - 0 - no compression, standard JSON array
 ///  - 1 - exclude leading, trailing zeros, required JSROOT v5
 ///  - 2 - check values repetition and empty gaps, required JSROOT v5
+///  - 3 - exclude leading, trailing zeros and store other values as base64-coded
+///        little-endian binary data (Bool_t and 64-bit integers compressed as with 2),
+///        only read back by TBufferJSON, not by JSROOT
 ///
-/// Maximal compression achieved when compact parameter equal to 23
+/// Maximal compression readable by JSROOT achieved when compact parameter equal to 23,
+/// maximal compression when equal to 33
 /// When member_name specified, converts only this data member
 
 TString TBufferJSON::ConvertToJSON(const TObject *obj, Int_t compact, const char *member_name)
@@ -439,6 +447,9 @@ TString TBufferJSON::ConvertToJSON(const TObject *obj, Int_t compact, const char
 //  - 0 - no compression, standard JSON array
 //  - 1 - exclude leading, trailing zeros, required JSROOT v5
 //  - 2 - check values repetition and empty gaps, required JSROOT v5
+//  - 3 - exclude leading, trailing zeros and store other values as base64-coded
+//        little-endian binary data (not used for Bool_t and 64-bit integers,
+//        which are compressed as with 2)
 
 void TBufferJSON::SetCompact(int level)
 {
@@ -460,8 +471,12 @@ void TBufferJSON::SetCompact(int level)
 ///  - 0 - no compression, standard JSON array
 ///  - 1 - exclude leading, trailing zeros, required JSROOT v5
 ///  - 2 - check values repetition and empty gaps, required JSROOT v5
+///  - 3 - exclude leading, trailing zeros and store other values as base64-coded
+///        little-endian binary data (Bool_t and 64-bit integers compressed as with 2),
+///        only read back by TBufferJSON, not by JSROOT
 ///
-/// Maximal compression achieved when compact parameter equal to 23
+/// Maximal compression readable by JSROOT achieved when compact parameter equal to 23,
+/// maximal compression when equal to 33
 /// When member_name specified, converts only this data member
 
 TString TBufferJSON::ConvertToJSON(const void *obj, const TClass *cl, Int_t compact, const char *member_name)
@@ -524,7 +539,7 @@ TString TBufferJSON::ConvertToJSON(const void *obj, const TClass *cl, Int_t comp
 ////////////////////////////////////////////////////////////////////////////////
 /// Converts selected data member into json
 /// Parameter ptr specifies address in memory, where data member is located
-/// compact parameter defines compactness of produced JSON (from 0 to 3)
+/// compact parameter defines compactness of produced JSON, see ConvertToJSON(const TObject*, ...)
 /// arraylen (when specified) is array length for this data member,  //[fN] case
 
 TString TBufferJSON::ConvertToJSON(const void *ptr, TDataMember *member, Int_t compact, Int_t arraylen)
@@ -2404,6 +2419,54 @@ Int_t TBufferJSON::ReadStaticArray(Double_t *d)
    return JsonReadArray(d);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Returns true if array of such type can be stored as base64-coded binary data,
+/// which is directly mapped to JavaScript typed arrays
+
+template <typename T>
+static constexpr bool JsonBase64Coded()
+{
+   return !std::is_same<T, Bool_t>::value && (std::is_floating_point<T>::value || (sizeof(T) <= 4));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Append values as base64-coded little-endian binary data
+
+template <typename T>
+static void JsonWriteBase64(const T *values, Int_t len, TString &out)
+{
+#ifdef R__BYTESWAP
+   out.Append(TBase64::Encode((const char *)values, len * sizeof(T)));
+#else
+   std::vector<T> swapped(values, values + len);
+   for (auto &v : swapped) {
+      char *bytes = (char *)&v;
+      std::reverse(bytes, bytes + sizeof(T));
+   }
+   out.Append(TBase64::Encode((const char *)swapped.data(), len * sizeof(T)));
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Decode base64-coded little-endian binary data, returns number of decoded values
+
+template <typename T>
+static Int_t JsonReadBase64(const std::string &coded, T *values, Int_t maxlen)
+{
+   TString bytes = TBase64::Decode(coded.c_str());
+   Int_t len = bytes.Length() / sizeof(T);
+   if (len > maxlen)
+      len = maxlen;
+   memcpy((void *)values, bytes.Data(), len * sizeof(T));
+#ifndef R__BYTESWAP
+   for (Int_t n = 0; n < len; ++n) {
+      char *b = (char *)(values + n);
+      std::reverse(b, b + sizeof(T));
+   }
+#endif
+   return len;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Template method to read array from the JSON
 
@@ -2440,6 +2503,14 @@ R__ALWAYS_INLINE void TBufferJSON::JsonReadFastArray(T *arr, Int_t arrsize, bool
          arr[cnt] = 0;
       int p = 0, id = 0;
       std::string idname = "", pname, vname, nname;
+      if (json->count("b") == 1) {
+         // values stored as base64-coded binary data
+         if (json->count("p") == 1)
+            p = json->at("p").get<int>();
+         if ((p >= 0) && (p < arrsize))
+            JsonReadBase64(json->at("b").get<std::string>(), arr + p, arrsize - p);
+         p = arrsize;
+      }
       while (p < arrsize) {
          pname = std::string("p") + idname;
          if (json->count(pname) == 1)
@@ -2689,7 +2760,14 @@ R__ALWAYS_INLINE void TBufferJSON::JsonWriteArrayCompress(const T *vname, Int_t
          aindx++;
       while ((aindx < bindx) && (vname[bindx - 1] == 0))
          bindx--;
-      if (aindx < bindx) {
+      if ((aindx < bindx) && (fCompact >= 30) && JsonBase64Coded<T>()) {
+         if (aindx > 0)
+            fValue.Append(TString::Format("%s\"p\":%d", fArraySepar.Data(), aindx));
+         fValue.Append(fArraySepar);
+         fValue.Append("\"b\":\"");
+         JsonWriteBase64(vname + aindx, bindx - aindx, fValue);
+         fValue.Append("\"");
+      } else if (aindx < bindx) {
          TString suffix("");
          Int_t p(aindx), suffixcnt(-1), lastp(0);
          while (p < bindx) {
@@ -827,6 +827,38 @@ const char *TBufferText::GetDoubleFormat()
    return fgDoubleFmt;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Write integral value as decimal number, produces same output as
+/// snprintf(buf, len, "%1.0f", value) but several times faster.
+/// Used for histograms bin contents and other integer values stored as floating point.
+
+static void ConvertIntegral(Double_t value, char *buf, unsigned len)
+{
+   if ((std::abs(value) >= 1e18) || ((value == 0) && std::signbit(value))) {
+      snprintf(buf, len, "%1.0f", value);
+      return;
+   }
+
+   Long64_t ival = (Long64_t)value;
+   ULong64_t uval = (ival < 0) ? (ULong64_t)(-ival) : (ULong64_t)ival;
+
+   char tmp[24], *pos = tmp + sizeof(tmp);
+   do {
+      *--pos = '0' + (char)(uval % 10);
+      uval /= 10;
+   } while (uval);
+   if (ival < 0)
+      *--pos = '-';
+
+   unsigned ndigits = tmp + sizeof(tmp) - pos;
+   if (ndigits >= len) {
+      snprintf(buf, len, "%1.0f", value);
+      return;
+   }
+   memcpy(buf, pos, ndigits);
+   buf[ndigits] = 0;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// convert float to string with configured format
 
@@ -835,7 +867,7 @@ const char *TBufferText::ConvertFloat(Float_t value, char *buf, unsigned len, Bo
    if (not_optimize) {
       snprintf(buf, len, fgFloatFmt, value);
    } else if ((value == std::nearbyint(value)) && (std::abs(value) < 1e15)) {
-      snprintf(buf, len, "%1.0f", value);
+      ConvertIntegral(value, buf, len);
    } else {
       snprintf(buf, len, fgFloatFmt, value);
       CompactFloatString(buf, len);
@@ -851,7 +883,7 @@ const char *TBufferText::ConvertDouble(Double_t value, char *buf, unsigned len,
    if (not_optimize) {
       snprintf(buf, len, fgFloatFmt, value);
    } else if ((value == std::nearbyint(value)) && (std::abs(value) < 1e25)) {
-      snprintf(buf, len, "%1.0f", value);
+      ConvertIntegral(value, buf, len);
    } else {
       snprintf(buf, len, fgDoubleFmt, value);
       CompactFloatString(buf, len);
@@ -39,6 +39,7 @@ End_Macro
 #include "TStreamerInfo.h"
 #include "TROOT.h"
 #include "TError.h"
+#include "TMath.h"
 #include "Bytes.h"
 #include "TClass.h"
 #include "TRegexp.h"
@@ -50,6 +51,8 @@ End_Macro
 
 const UInt_t kIsBigFile = BIT(16);
 const Int_t  kMaxLen = 2048;
+const Int_t  kInitialSize = 100; // Initial capacity of the lists of objects and keys
+const Int_t  kMinKeyRecord = 29; // Minimal size of a key record in the keys list (empty class name, name and title)
 
 ClassImp(TDirectoryFile);
 
@@ -332,8 +335,8 @@ void TDirectoryFile::Build(TFile* motherFile, TDirectory* motherDir)
    fSeekDir    = 0;
    fSeekParent = 0;
    fSeekKeys   = 0;
-   fList       = new THashList(100,50);
-   fKeys       = new THashList(100,50);
+   fList       = new THashList(kInitialSize,50);
+   fKeys       = new THashList(kInitialSize,50);
    fList->UseRWLock();
    fMother     = motherDir;
    fFile       = motherFile ? motherFile : TFile::CurrentFile();
@@ -1331,8 +1334,7 @@ Int_t TDirectoryFile::ReadKeys(Bool_t forceRead)
       Int_t nbytes = fNbytesName + TDirectoryFile::Sizeof();
       char *header = new char[nbytes];
       buffer       = header;
-      fFile->Seek(fSeekDir);
-      if ( fFile->ReadBuffer(buffer,nbytes) ) {
+      if ( fFile->ReadBuffer(buffer,fSeekDir,nbytes) ) {
          // ReadBuffer return kTRUE in case of failure.
          delete [] header;
          return 0;
@@ -1367,6 +1369,14 @@ Int_t TDirectoryFile::ReadKeys(Bool_t forceRead)
 
       TKey *key;
       frombuf(buffer, &nkeys);
+      // Size the hash table once for all the keys instead of letting it
+      // grow (with long collision lists and repeated rehashing) while the
+      // keys are added; this dominates the open time of directories with
+      // many thousands of keys.  nkeys comes from the file: do not trust it
+      // beyond the number of key records the keys buffer can hold.
+      Int_t nexpected = TMath::Min(nkeys, fNbytesKeys / kMinKeyRecord);
+      if (nexpected > kInitialSize)
+         ((THashList *)fKeys)->Rehash(fKeys->GetSize() + nexpected);
       for (Int_t i = 0; i < nkeys; i++) {
          key = new TKey(this);
          key->ReadKeyBuffer(buffer);
@@ -198,6 +198,8 @@ TFile::TFile() : TDirectoryFile(), fInfoCache(0)
    fInitDone        = kFALSE;
    fMustFlush       = kTRUE;
    fIsPcmFile       = kFALSE;
+   fPositionedRead  = kFALSE;
+   fSharedRead      = kFALSE;
    fAsyncHandle     = 0;
    fAsyncOpenStatus = kAOSNotAsync;
    SetBit(kBinaryFile, kTRUE);
@@ -349,6 +351,8 @@ TFile::TFile(const char *fname1, Option_t *option, const char *ftitle, Int_t com
 
    // if option contains filetype=pcm then go into ROOT PCM file mode
    fIsPcmFile = kFALSE;
+   fPositionedRead = kFALSE;
+   fSharedRead = kFALSE;
    if (strstr(fUrl.GetOptions(), "filetype=pcm"))
       fIsPcmFile = kTRUE;
 
@@ -517,6 +521,11 @@ TFile::TFile(const char *fname1, Option_t *option, const char *ftitle, Int_t com
       }
       fWritable = kFALSE;
    }
+#ifndef WIN32
+   // The descriptor was opened by TFile::SysOpen, the positioned read can be used
+   // while the file is not writable (see IsPositionedRead()).
+   fPositionedRead = kTRUE;
+#endif
 
    Init(create);
 
@@ -938,6 +947,10 @@ void TFile::Close(Option_t *option)
 
    // Finish any concurrent I/O operations before we close the file handles.
    if (fCacheRead) fCacheRead->Close();
+#ifdef R__USE_IMT
+   for (auto &entry : fThreadCacheRead)
+      entry.second->Close();
+#endif
    {
       TIter iter(fCacheReadMap);
       TObject *key = 0;
@@ -1114,8 +1127,11 @@ void TFile::Flush()
 
 Bool_t TFile::FlushWriteCache()
 {
-   if (fCacheWrite && IsOpen() && fWritable)
-      return fCacheWrite->Flush();
+   if (fCacheWrite && IsOpen() && fWritable) {
+      Bool_t status = fCacheWrite->Flush();
+      // With write-behind, wait until the data is actually on the file.
+      return fCacheWrite->Sync() || status;
+   }
    return kFALSE;
 }
 
@@ -1213,6 +1229,16 @@ void TFile::ResetErrno() const
 
 TFileCacheRead *TFile::GetCacheRead(TObject* tree) const
 {
+#ifdef R__USE_IMT
+   if (fSharedRead) {
+      // the default cache is the one set by the calling thread (see SetSharedRead())
+      std::lock_guard<std::mutex> lock(fSharedReadMutex);
+      TFileCacheRead *cache = tree ? (TFileCacheRead *)fCacheReadMap->GetValue(tree) : nullptr;
+      if (cache) return cache;
+      auto iter = fThreadCacheRead.find(std::this_thread::get_id());
+      return iter == fThreadCacheRead.end() ? nullptr : iter->second;
+   }
+#endif
    if (!tree) {
       if (!fCacheRead && fCacheReadMap->GetSize() == 1) {
          TIter next(fCacheReadMap);
@@ -1617,15 +1643,26 @@ void TFile::Print(Option_t *option) const
 /// Returns kTRUE in case of failure.
 /// Compared to ReadBuffer(char*, Int_t), this routine does _not_
 /// change the cursor on the physical file representation (fD)
-/// if the data is in this TFile's cache.
+/// if the data is in this TFile's cache.  For local files opened
+/// read-only by TFile (see IsPositionedRead()), the data is read with a
+/// positioned read (pread): neither the cursor of fD nor the file offset
+/// (see GetRelOffset()) are used or changed, whether the data comes from
+/// the cache or from the file. Several threads can then read the file at
+/// once in shared read mode (see SetSharedRead()).
 
 Bool_t TFile::ReadBuffer(char *buf, Long64_t pos, Int_t len)
 {
    if (IsOpen()) {
 
+      Int_t st;
+      if (IsPositionedRead()) {
+         if ((st = ReadBufferViaCache(buf, pos, len)))
+            return st == 2;
+         return ReadBufferPositioned(buf, pos, len);
+      }
+
       SetOffset(pos);
 
-      Int_t st;
       Double_t start = 0;
       if (gPerfStats != 0) start = TTimeStamp();
 
@@ -1635,9 +1672,8 @@ Bool_t TFile::ReadBuffer(char *buf, Long64_t pos, Int_t len)
          return kFALSE;
       }
 
-      Seek(pos);
       ssize_t siz;
-
+      Seek(pos);
       while ((siz = SysRead(fD, buf, len)) < 0 && GetErrno() == EINTR)
          ResetErrno();
 
@@ -1665,9 +1701,65 @@ Bool_t TFile::ReadBuffer(char *buf, Long64_t pos, Int_t len)
    return kTRUE;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Read a buffer from the file at the offset 'pos' with a positioned read
+/// (pread), without using the read cache.
+///
+/// Neither the file offset nor the cursor of fD are used or changed.
+/// Returns kTRUE in case of failure.
+
+Bool_t TFile::ReadBufferPositioned(char *buf, Long64_t pos, Int_t len)
+{
+   ssize_t siz;
+   Double_t start = 0;
+   if (gPerfStats != 0) start = TTimeStamp();
+
+#ifndef WIN32
+   while ((siz = ::pread(fD, buf, len, pos + fArchiveOffset)) < 0 && GetErrno() == EINTR)
+      ResetErrno();
+#else
+   // not used: positioned reads are not available on Windows
+   Seek(pos);
+   while ((siz = SysRead(fD, buf, len)) < 0 && GetErrno() == EINTR)
+      ResetErrno();
+#endif
+
+   if (siz < 0) {
+      SysError("ReadBuffer", "error reading from file %s", GetName());
+      return kTRUE;
+   }
+   if (siz != len) {
+      Error("ReadBuffer", "error reading all requested bytes from file %s, got %ld of %d",
+            GetName(), (Long_t)siz, len);
+      return kTRUE;
+   }
+   fgBytesRead += siz;
+   fgReadCalls++;
+
+#ifdef R__USE_IMT
+   // the statistics of the file are shared by the threads in shared read mode
+   std::unique_lock<std::mutex> lock(fSharedReadMutex, std::defer_lock);
+   if (fSharedRead)
+      lock.lock();
+#endif
+   fBytesRead  += siz;
+   fReadCalls++;
+
+   if (gMonitoringWriter)
+      gMonitoringWriter->SendFileReadProgress(this);
+   if (gPerfStats != 0) {
+      gPerfStats->FileReadEvent(this, len, start);
+   }
+   return kFALSE;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Read a buffer from the file. This is the basic low level read operation.
 /// Returns kTRUE in case of failure.
+/// The data is read at the current position (see Seek()). For local files
+/// opened read-only by TFile (see IsPositionedRead()) it is read with a
+/// positioned read at the file offset, which is then advanced by len; the
+/// cursor of fD is not used.
 
 Bool_t TFile::ReadBuffer(char *buf, Int_t len)
 {
@@ -1680,6 +1772,13 @@ Bool_t TFile::ReadBuffer(char *buf, Int_t len)
          return kFALSE;
       }
 
+      if (IsPositionedRead()) {
+         if (ReadBufferPositioned(buf, GetRelOffset(), len))
+            return kTRUE;
+         fOffset += len;
+         return kFALSE;
+      }
+
       ssize_t siz;
       Double_t start = 0;
 
@@ -1734,8 +1833,15 @@ Bool_t TFile::ReadBuffers(char *buf, Long64_t *pos, Int_t *len, Int_t nbuf)
 
    Int_t k = 0;
    Bool_t result = kTRUE;
+   // The blocks are read from the file, not from the read cache being filled.
+   // In shared read mode the default cache is per thread and cannot be reset
+   // here: the blocks are read directly with positioned reads.
+   auto readBlock = [this](char *b, Long64_t p, Int_t l) {
+      return fSharedRead ? ReadBufferPositioned(b, p, l) : ReadBuffer(b, p, l);
+   };
    TFileCacheRead *old = fCacheRead;
-   fCacheRead = 0;
+   if (!fSharedRead)
+      fCacheRead = 0;
    Long64_t curbegin = pos[0];
    Long64_t cur;
    char *buf2 = 0;
@@ -1748,18 +1854,16 @@ Bool_t TFile::ReadBuffers(char *buf, Long64_t *pos, Int_t *len, Int_t nbuf)
          if (n == 0) {
             //if the block to read is about the same size as the read-ahead buffer
             //we read the block directly
-            Seek(pos[i]);
-            result = ReadBuffer(&buf[k], len[i]);
+            result = readBlock(&buf[k], pos[i], len[i]);
             if (result) break;
             k += len[i];
             i++;
          } else {
             //otherwise we read all blocks that fit in the read-ahead buffer
-            Seek(curbegin);
             if (buf2 == 0) buf2 = new char[fgReadaheadSize];
             //we read ahead
             Long64_t nahead = pos[i-1]+len[i-1]-curbegin;
-            result = ReadBuffer(buf2, nahead);
+            result = readBlock(buf2, curbegin, nahead);
             if (result) break;
             //now copy from the read-ahead buffer to the cache
             Int_t kold = k;
@@ -1778,7 +1882,8 @@ Bool_t TFile::ReadBuffers(char *buf, Long64_t *pos, Int_t *len, Int_t nbuf)
       }
    }
    if (buf2) delete [] buf2;
-   fCacheRead = old;
+   if (!fSharedRead)
+      fCacheRead = old;
    return result;
 }
 
@@ -1791,8 +1896,8 @@ Bool_t TFile::ReadBuffers(char *buf, Long64_t *pos, Int_t *len, Int_t nbuf)
 Int_t TFile::ReadBufferViaCache(char *buf, Int_t len)
 {
    Long64_t off = GetRelOffset();
-   if (fCacheRead) {
-      Int_t st = fCacheRead->ReadBuffer(buf, off, len);
+   if (TFileCacheRead *cache = GetCurrentCacheRead()) {
+      Int_t st = cache->ReadBuffer(buf, off, len);
       if (st < 0)
          return 2;  // failure reading
       else if (st == 1) {
@@ -1800,8 +1905,12 @@ Int_t TFile::ReadBufferViaCache(char *buf, Int_t len)
          SetOffset(off + len);
          return 1;
       }
-      // fOffset might have been changed via TFileCacheRead::ReadBuffer(), reset it
-      Seek(off);
+      // fOffset might have been changed via TFileCacheRead::ReadBuffer(), reset it;
+      // positioned reads do not need the cursor of the descriptor to be moved
+      if (IsPositionedRead())
+         SetOffset(off);
+      else
+         Seek(off);
    } else {
       // if write cache is active check if data still in write cache
       if (fWritable && fCacheWrite) {
@@ -1817,6 +1926,41 @@ Int_t TFile::ReadBufferViaCache(char *buf, Int_t len)
    return 0;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Read buffer at the offset 'pos' via the read cache, for the positioned
+/// reads. The file offset is neither used nor changed.
+///
+/// Returns 0 if the requested block is not in the cache, 1 in case read via
+/// cache was successful, 2 in case read via cache failed.
+
+Int_t TFile::ReadBufferViaCache(char *buf, Long64_t pos, Int_t len)
+{
+   // the positioned reads are used only for read-only files: there is no write cache
+   if (TFileCacheRead *cache = GetCurrentCacheRead()) {
+      Int_t st = cache->ReadBuffer(buf, pos, len);
+      if (st < 0)
+         return 2;
+      return st == 1 ? 1 : 0;
+   }
+   return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the read cache used by ReadBuffer: the last one set with
+/// SetCacheRead, by the calling thread in shared read mode.
+
+TFileCacheRead *TFile::GetCurrentCacheRead() const
+{
+#ifdef R__USE_IMT
+   if (fSharedRead) {
+      std::lock_guard<std::mutex> lock(fSharedReadMutex);
+      auto iter = fThreadCacheRead.find(std::this_thread::get_id());
+      return iter == fThreadCacheRead.end() ? nullptr : iter->second;
+   }
+#endif
+   return fCacheRead;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Read the FREE linked list.
 ///
@@ -2119,6 +2263,9 @@ Int_t TFile::ReOpen(Option_t *mode)
    } else {
       // switch to UPDATE mode
 
+      // the file is not read with positioned reads anymore
+      if (fSharedRead) SetSharedRead(kFALSE);
+
       // close readonly file
       if (IsOpen()) {
          SysClose(fD);
@@ -2266,6 +2413,41 @@ void TFile::SetCompressionSettings(Int_t settings)
 
 void TFile::SetCacheRead(TFileCacheRead *cache, TObject* tree, ECacheAction action)
 {
+#ifdef R__USE_IMT
+   if (fSharedRead) {
+      // The cache becomes the default cache of the calling thread only.
+      // The caches are (dis)connected outside of the lock, since this might
+      // call back SetCacheRead.
+      TFileCacheRead *disconnect = nullptr;
+      {
+         std::lock_guard<std::mutex> lock(fSharedReadMutex);
+         TFileCacheRead *&current = fThreadCacheRead[std::this_thread::get_id()];
+         TFileCacheRead *removed = nullptr;
+         if (tree) {
+            if (cache) fCacheReadMap->Add(tree, cache);
+            else {
+               removed = (TFileCacheRead *)fCacheReadMap->GetValue(tree);
+               fCacheReadMap->Remove(tree);
+            }
+         } else if (!cache) {
+            removed = current;
+         }
+         current = cache;
+         if (removed && (removed->GetFile() == this) && (action != kDoNotDisconnect))
+            disconnect = removed;
+         // a cache removed from the file is not the default cache of any thread anymore
+         for (auto iter = fThreadCacheRead.begin(); iter != fThreadCacheRead.end();) {
+            if (!iter->second || iter->second == removed)
+               iter = fThreadCacheRead.erase(iter);
+            else
+               ++iter;
+         }
+      }
+      if (disconnect) disconnect->SetFile(0, action);
+      if (cache) cache->SetFile(this, action);
+      return;
+   }
+#endif
    if (tree) {
       if (cache) fCacheReadMap->Add(tree, cache);
       else {
@@ -2282,6 +2464,56 @@ void TFile::SetCacheRead(TFileCacheRead *cache, TObject* tree, ECacheAction acti
    fCacheRead = cache;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Enable (or disable) the shared read mode, in which several threads read
+/// this TFile object at once, sharing its descriptor, header, streamer infos
+/// and keys instead of each opening the file.
+///
+/// The file must be a local file opened in READ mode, which is read with
+/// positioned reads (see IsPositionedRead()), and ROOT must be built with
+/// implicit multi-threading support. In this mode:
+///  - ReadBuffer(char*, Long64_t, Int_t), and thus TKey::ReadFile and the
+///    reads of the TTree baskets, neither use nor change the file offset and
+///    can be called by several threads at once;
+///  - the read cache set with SetCacheRead (e.g. the TTreeCache of a TTree)
+///    is the default read cache of the calling thread only: each thread
+///    reading its own TTree from the file uses its own cache.
+///
+/// Getting objects from the directories of the file (TDirectoryFile::Get)
+/// modifies them and must still be serialized by the caller. Seek() and
+/// ReadBuffer(char*, Int_t) use the file offset, which is shared.
+///
+/// Returns kFALSE if the shared read mode cannot be enabled.
+
+Bool_t TFile::SetSharedRead(Bool_t shared)
+{
+#ifdef R__USE_IMT
+   if (shared == fSharedRead)
+      return kTRUE;
+   if (shared && !IsPositionedRead()) {
+      Error("SetSharedRead", "file %s is not a local file opened in READ mode", GetName());
+      return kFALSE;
+   }
+   std::lock_guard<std::mutex> lock(fSharedReadMutex);
+   if (shared) {
+      // the default cache becomes the one of the calling thread
+      if (fCacheRead)
+         fThreadCacheRead[std::this_thread::get_id()] = fCacheRead;
+      fCacheRead = nullptr;
+   } else {
+      auto iter = fThreadCacheRead.find(std::this_thread::get_id());
+      fCacheRead = (iter == fThreadCacheRead.end()) ? nullptr : iter->second;
+      fThreadCacheRead.clear();
+   }
+   fSharedRead = shared;
+   return kTRUE;
+#else
+   if (shared)
+      Error("SetSharedRead", "ROOT was built without implicit multi-threading support");
+   return !shared;
+#endif
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Set a pointer to the write cache.
 ///
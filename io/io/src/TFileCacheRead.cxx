@@ -506,7 +506,8 @@ Int_t TFileCacheRead::ReadBufferExtNormal(char *buf, Long64_t pos, Int_t len, In
             if (fFile->ReadBuffer(buf, pos, len)) {
                return -1;
             }
-            fFile->SetOffset(pos+len);
+            if (!fFile->IsPositionedRead())
+               fFile->SetOffset(pos+len);
          }
 
          retval = 1;
@@ -529,7 +530,10 @@ Int_t TFileCacheRead::ReadBufferExtNormal(char *buf, Long64_t pos, Int_t len, In
       if (loc >= 0 && loc <fNseek && pos == fSeekSort[loc]) {
          if (buf) {
             memcpy(buf,&fBuffer[fSeekPos[loc]],len);
-            fFile->SetOffset(pos+len);
+            // the positioned reads of the file do not use its offset, which
+            // might be shared by several threads (see TFile::SetSharedRead)
+            if (!fFile->IsPositionedRead())
+               fFile->SetOffset(pos+len);
          }
          return 1;
       }
@@ -23,11 +23,176 @@ TXNetFile and TWebFile (via TFile::WriteBuffers()).
 
 The write cache is automatically created when writing a remote file
 (created in TFile::Open()).
+
+For local files, EnableWriteBehind() turns the cache into a write-behind
+buffer: a full cache is handed to a background thread which writes it to
+the file while the caller keeps filling a fresh buffer.  At most
+`maxPending` buffers are queued; beyond that the producer waits.  Errors
+from the background writes are reported by the next Flush() or Sync(),
+and therefore at the latest by TFile::Flush() and TFile::Close().
 */
 
 
 #include "TFile.h"
 #include "TFileCacheWrite.h"
+#include <cerrno>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#ifndef WIN32
+#include <unistd.h>
+#endif
+
+namespace ROOT {
+namespace Internal {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Queue of full write-cache buffers, written in order by a dedicated thread
+/// with positioned writes (which leave the file offset of the descriptor,
+/// used by the owning TFile, untouched).
+/// Each buffer carries the descriptor the file had when it was queued: the
+/// file can be closed and reopened (TFile::ReOpen) with the queue drained in
+/// between, so the descriptor is not cached by the queue itself.
+
+class TWriteBehindQueue {
+   struct TBlock {
+      char    *fBuffer;
+      Long64_t fPos;
+      Int_t    fLen;
+      int      fFd;
+   };
+
+   Int_t                   fMaxPending;  ///< Maximum number of queued buffers
+   Int_t                   fBufferSize;  ///< Size of each buffer
+   std::mutex              fMutex;
+   std::condition_variable fCond;        ///< Signalled on every change of state
+   std::deque<TBlock>      fPending;     ///< Buffers waiting to be written
+   std::vector<char *>     fFree;        ///< Written buffers, ready for reuse
+   Bool_t                  fBusy{kFALSE};  ///< A buffer is being written
+   Bool_t                  fStop{kFALSE};  ///< Ask the thread to terminate
+   Int_t                   fErrno{0};      ///< First error of a background write
+   std::thread             fThread;
+
+   void Run();
+
+public:
+   TWriteBehindQueue(Int_t maxPending, Int_t bufferSize);
+   ~TWriteBehindQueue();
+
+   char  *Push(char *buffer, Long64_t pos, Int_t len, int fd);
+   Int_t  Wait();
+   Bool_t IsIdle();
+};
+
+TWriteBehindQueue::TWriteBehindQueue(Int_t maxPending, Int_t bufferSize)
+   : fMaxPending(maxPending < 1 ? 1 : maxPending), fBufferSize(bufferSize)
+{
+   fThread = std::thread(&TWriteBehindQueue::Run, this);
+}
+
+TWriteBehindQueue::~TWriteBehindQueue()
+{
+   Wait();
+   {
+      std::lock_guard<std::mutex> lock(fMutex);
+      fStop = kTRUE;
+   }
+   fCond.notify_all();
+   fThread.join();
+   for (auto buf : fFree)
+      delete [] buf;
+}
+
+void TWriteBehindQueue::Run()
+{
+   std::unique_lock<std::mutex> lock(fMutex);
+   while (true) {
+      fCond.wait(lock, [this] { return fStop || !fPending.empty(); });
+      if (fPending.empty())
+         return; // fStop and nothing left to write
+      TBlock block = fPending.front();
+      fPending.pop_front();
+      fBusy = kTRUE;
+      lock.unlock();
+
+      Int_t err = 0;
+#ifndef WIN32
+      const char *cur = block.fBuffer;
+      Long64_t pos = block.fPos;
+      Int_t left = block.fLen;
+      while (left > 0) {
+         ssize_t siz = ::pwrite(block.fFd, cur, left, pos);
+         if (siz < 0) {
+            if (errno == EINTR) continue;
+            err = errno;
+            break;
+         }
+         if (siz == 0) {
+            err = EIO;
+            break;
+         }
+         cur += siz;
+         pos += siz;
+         left -= siz;
+      }
+#endif
+
+      lock.lock();
+      if (err && !fErrno) fErrno = err;
+      fFree.push_back(block.fBuffer);
+      fBusy = kFALSE;
+      fCond.notify_all();
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Queue `buffer` to be written at `pos` of the file descriptor `fd` and return
+/// an empty buffer for the caller to fill next.  Waits while fMaxPending
+/// buffers are already queued.
+
+char *TWriteBehindQueue::Push(char *buffer, Long64_t pos, Int_t len, int fd)
+{
+   std::unique_lock<std::mutex> lock(fMutex);
+   fCond.wait(lock, [this] { return (Int_t)fPending.size() < fMaxPending; });
+   fPending.push_back({buffer, pos, len, fd});
+   char *next = nullptr;
+   if (!fFree.empty()) {
+      next = fFree.back();
+      fFree.pop_back();
+   }
+   lock.unlock();
+   fCond.notify_all();
+   return next ? next : new char[fBufferSize];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Wait until all queued buffers are written.  Returns the errno of the first
+/// failed write since the previous call (0 if none) and clears it.
+
+Int_t TWriteBehindQueue::Wait()
+{
+   std::unique_lock<std::mutex> lock(fMutex);
+   fCond.wait(lock, [this] { return fPending.empty() && !fBusy; });
+   Int_t err = fErrno;
+   fErrno = 0;
+   return err;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return true if no write is queued or in flight.
+
+Bool_t TWriteBehindQueue::IsIdle()
+{
+   std::lock_guard<std::mutex> lock(fMutex);
+   return fPending.empty() && !fBusy;
+}
+
+} // namespace Internal
+} // namespace ROOT
 
 ClassImp(TFileCacheWrite);
 
@@ -42,6 +207,7 @@ TFileCacheWrite::TFileCacheWrite() : TObject()
    fFile        = 0;
    fBuffer      = 0;
    fRecursive   = kFALSE;
+   fWriteBehind = nullptr;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -59,6 +225,7 @@ TFileCacheWrite::TFileCacheWrite(TFile *file, Int_t buffersize)
    fNtot        = 0;
    fFile        = file;
    fRecursive   = kFALSE;
+   fWriteBehind = nullptr;
    fBuffer      = new char[fBufferSize];
    if (file) file->SetCacheWrite(this);
    if (gDebug > 0) Info("TFileCacheWrite","Creating a write cache with buffersize=%d bytes",buffersize);
@@ -69,15 +236,54 @@ TFileCacheWrite::TFileCacheWrite(TFile *file, Int_t buffersize)
 
 TFileCacheWrite::~TFileCacheWrite()
 {
+   if (fWriteBehind && Sync())
+      Error("~TFileCacheWrite", "error writing to file %s", fFile ? fFile->GetName() : "");
+   delete fWriteBehind;
    delete [] fBuffer;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Write the full cache buffers from a background thread, letting the caller
+/// continue with an empty buffer.  At most maxPending buffers (each of the
+/// size of this cache) wait to be written.
+///
+/// Only local files opened by TFile itself support write-behind.
+/// Returns kTRUE if write-behind is (now) enabled.
+
+Bool_t TFileCacheWrite::EnableWriteBehind(Int_t maxPending)
+{
+#ifdef WIN32
+   (void)maxPending;
+   return kFALSE;
+#else
+   if (fWriteBehind) return kTRUE;
+   if (!fFile || fFile->IsA() != TFile::Class() || fFile->GetFd() < 0 || fFile->fIsArchive) {
+      Warning("EnableWriteBehind", "write-behind is only supported for local files");
+      return kFALSE;
+   }
+   fWriteBehind = new ROOT::Internal::TWriteBehindQueue(maxPending, fBufferSize);
+   return kTRUE;
+#endif
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Flush the current write buffer to the file.
 /// Returns kTRUE in case of error.
 
 Bool_t TFileCacheWrite::Flush()
 {
+   if (fWriteBehind) {
+      if (fNtot) {
+         fFile->fBytesWrite += fNtot;
+         TFile::fgBytesWrite += fNtot;
+         // The descriptor is taken from the file at each flush: it changes
+         // when the file is reopened (the queue is drained before closing it).
+         fBuffer = fWriteBehind->Push(fBuffer, fSeekStart, fNtot, fFile->GetFd());
+         fNtot = 0;
+      }
+      // Report the failure of an earlier background write, if any.
+      return fWriteBehind->IsIdle() ? Sync() : kFALSE;
+   }
    if (!fNtot) return kFALSE;
    fFile->Seek(fSeekStart);
    //printf("Flushing buffer at fSeekStart=%lld, fNtot=%d\n",fSeekStart,fNtot);
@@ -107,6 +313,8 @@ void TFileCacheWrite::Print(Option_t *option) const
 
 Int_t TFileCacheWrite::ReadBuffer(char *buf, Long64_t pos, Int_t len)
 {
+   // Data handed to the background writer must reach the file first.
+   if (fWriteBehind && !fWriteBehind->IsIdle()) Sync();
    if (pos < fSeekStart || pos+len > fSeekStart+fNtot) return -1;
    memcpy(buf,fBuffer+pos-fSeekStart,len);
    return 0;
@@ -132,6 +340,8 @@ Int_t TFileCacheWrite::WriteBuffer(const char *buf, Long64_t pos, Int_t len)
       if (Flush()) return -1; //failure
       if (len >= fBufferSize) {
          //buffer larger than the cache itself: direct write to file
+         //(after the queued writes, which may cover the same region)
+         if (fWriteBehind && Sync()) return -1;
          fRecursive = kTRUE;
          fFile->Seek(pos); // Flush may have changed this
          if (fFile->WriteBuffer(buf,len)) return -1;  // failure
@@ -152,5 +362,25 @@ Int_t TFileCacheWrite::WriteBuffer(const char *buf, Long64_t pos, Int_t len)
 
 void TFileCacheWrite::SetFile(TFile *file)
 {
+   if (fWriteBehind) {
+      Sync();
+      delete fWriteBehind;
+      fWriteBehind = nullptr;
+   }
    fFile = file;
 }
+
+////////////////////////////////////////////////////////////////////////////////
+/// Wait until the buffers handed to the background writer are on the file.
+/// Returns kTRUE if one of those writes failed since the previous call.
+
+Bool_t TFileCacheWrite::Sync()
+{
+   if (!fWriteBehind) return kFALSE;
+   Int_t err = fWriteBehind->Wait();
+   if (!err) return kFALSE;
+   fFile->SetBit(TFile::kWriteError);
+   fFile->SetWritable(kFALSE);
+   Error("Sync", "error writing to file %s: %s", fFile->GetName(), strerror(err));
+   return kTRUE;
+}
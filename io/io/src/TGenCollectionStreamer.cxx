@@ -30,6 +30,7 @@ size(), clear(), resize(). resize() may be a void operation.
 #include "TStreamerElement.h"
 #include "Riostream.h"
 #include "TVirtualCollectionIterators.h"
+#include "ReadConvertFastArray.h"
 
 TGenCollectionStreamer::TGenCollectionStreamer(const TGenCollectionStreamer& copy)
       : TGenCollectionProxy(copy), fReadBufferFunc(&TGenCollectionStreamer::ReadBufferDefault)
@@ -1113,37 +1114,25 @@ void TGenCollectionStreamer::WriteMap(int nElements, TBuffer &b)
 template <typename From, typename To>
 void TGenCollectionStreamer::ConvertBufferVectorPrimitives(TBuffer &b, void *obj, Int_t nElements)
 {
-   From *temp = new From[nElements];
-   b.ReadFastArray(temp, nElements);
    std::vector<To> *const vec = (std::vector<To>*)(obj);
-   for(Int_t ind = 0; ind < nElements; ++ind) {
-      (*vec)[ind] = (To)temp[ind];
-   }
-   delete [] temp;
+   ROOT::Internal::ReadConvertFastArray<From>(*vec, nElements,
+      [&b](From *temp, Int_t n) { b.ReadFastArray(temp, n); });
 }
 
 template <typename To>
 void TGenCollectionStreamer::ConvertBufferVectorPrimitivesFloat16(TBuffer &b, void *obj, Int_t nElements)
 {
-   Float16_t *temp = new Float16_t[nElements];
-   b.ReadFastArrayFloat16(temp, nElements);
    std::vector<To> *const vec = (std::vector<To>*)(obj);
-   for(Int_t ind = 0; ind < nElements; ++ind) {
-      (*vec)[ind] = (To)temp[ind];
-   }
-   delete [] temp;
+   ROOT::Internal::ReadConvertFastArray<Float16_t>(*vec, nElements,
+      [&b](Float16_t *temp, Int_t n) { b.ReadFastArrayFloat16(temp, n); });
 }
 
 template <typename To>
 void TGenCollectionStreamer::ConvertBufferVectorPrimitivesDouble32(TBuffer &b, void *obj, Int_t nElements)
 {
-   Double32_t *temp = new Double32_t[nElements];
-   b.ReadFastArrayDouble32(temp, nElements);
    std::vector<To> *const vec = (std::vector<To>*)(obj);
-   for(Int_t ind = 0; ind < nElements; ++ind) {
-      (*vec)[ind] = (To)temp[ind];
-   }
-   delete [] temp;
+   ROOT::Internal::ReadConvertFastArray<Double32_t>(*vec, nElements,
+      [&b](Double32_t *temp, Int_t n) { b.ReadFastArrayDouble32(temp, n); });
 }
 
 template <typename To>
@@ -155,8 +155,7 @@ TKey::TKey(TDirectory* motherDir, const TKey &orig, UShort_t pidOffset) : TNamed
    TFile* f = orig.GetFile();
    if (f) {
       Int_t nsize = orig.fNbytes;
-      f->Seek(orig.fSeekKey);
-      if( f->ReadBuffer(fBuffer+bufferIncOffset,nsize) )
+      if( f->ReadBuffer(fBuffer+bufferIncOffset,orig.fSeekKey,nsize) )
       {
          Error("ReadFile", "Failed to read data.");
          return;
@@ -1256,15 +1255,16 @@ Bool_t TKey::ReadFile()
    if (f==0) return kFALSE;
 
    Int_t nsize = fNbytes;
-   f->Seek(fSeekKey);
 #if 0
+   f->Seek(fSeekKey);
    for (Int_t i = 0; i < nsize; i += kMAXFILEBUFFER) {
       int nb = kMAXFILEBUFFER;
       if (i+nb > nsize) nb = nsize - i;
       f->ReadBuffer(fBuffer+i,nb);
    }
 #else
-   if( f->ReadBuffer(fBuffer,nsize) )
+   // positioned read: the file offset is not used (see TFile::SetSharedRead)
+   if( f->ReadBuffer(fBuffer,fSeekKey,nsize) )
    {
       Error("ReadFile", "Failed to read data.");
       return kFALSE;
@@ -53,6 +53,14 @@ classes don't provide these copy ctor's, especially not when objects
 contain collections, etc. 2) is too limiting or dangerous (calling
 accidentally a virtual function will segv). So since we have a
 robust Streamer mechanism I opted for 3).
+
+The shared memory is locked only while a streamed object is copied
+into or out of it. Update() streams the objects into private memory
+first and Get() deserializes a private copy of the buffer, so that a
+producer and many consumers do not block each other during streaming.
+Consumers which poll the shared memory can use GetUpdateCount() to
+check whether an object was updated since they last retrieved it,
+without deserializing it again.
 **/
 
 
@@ -100,6 +108,7 @@ robust Streamer mechanism I opted for 3).
 #include "mmprivate.h"
 
 #include <cmath>
+#include <memory>
 
 #if defined(R__UNIX) && !defined(R__MACOSX) && !defined(R__WINGCC)
 #define HAVE_SEMOP
@@ -165,6 +174,7 @@ TMapRec::TMapRec(const char *name, const TObject *obj, Int_t size, void *buf)
    fObject    = (TObject*)obj;
    fBuffer    = buf;
    fBufSize   = size;
+   fUpdates   = 0;
    fNext      = 0;
 }
 
@@ -591,10 +601,9 @@ void TMapFile::Add(const TObject *obj, const char *name)
 {
    if (!fWritable || !fMmallocDesc) return;
 
-   Bool_t lock = fGetting != obj ? kTRUE : kFALSE;
-
-   if (lock)
-      AcquireSemaphore();
+   // Get() does not hold the semaphore while it creates and streams the
+   // object anymore, so an Add() called from there must lock as well.
+   AcquireSemaphore();
 
    ROOT::Internal::gMmallocDesc = fMmallocDesc;
 
@@ -619,46 +628,56 @@ void TMapFile::Add(const TObject *obj, const char *name)
 
    ROOT::Internal::gMmallocDesc = 0;
 
-   if (lock)
-      ReleaseSemaphore();
+   ReleaseSemaphore();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Update an object (or all objects, if obj == 0) in shared memory.
+///
+/// Objects are streamed into private memory and the shared memory is
+/// only locked while the result is copied into it.
 
 void TMapFile::Update(TObject *obj)
 {
    if (!fWritable || !fMmallocDesc) return;
 
-   AcquireSemaphore();
-
-   ROOT::Internal::gMmallocDesc = fMmallocDesc;
-
    Bool_t all = (obj == 0) ? kTRUE : kFALSE;
 
+   TBufferFile local(TBuffer::kWrite, GetBestBuffer());
+
    TMapRec *mr = fFirst;
    while (mr) {
       if (all || mr->fObject == obj) {
+         local.SetBufferOffset(0);
+         local.ResetMap();
+         local.MapObject(mr->fObject);  //register obj in map to handle self reference
+         mr->fObject->Streamer(local);
+
+         AcquireSemaphore();
+
+         ROOT::Internal::gMmallocDesc = fMmallocDesc;
+
          TBufferFile *b;
          if (!mr->fBufSize) {
-            b = new TBufferFile(TBuffer::kWrite, GetBestBuffer());
+            b = new TBufferFile(TBuffer::kWrite, local.Length());
             mr->fClassName = StrDup(mr->fObject->ClassName());
          } else
             b = new TBufferFile(TBuffer::kWrite, mr->fBufSize, mr->fBuffer);
-         b->MapObject(mr->fObject);  //register obj in map to handle self reference
-         mr->fObject->Streamer(*b);
+         b->WriteBuf(local.Buffer(), local.Length());
          mr->fBufSize = b->BufferSize();
          mr->fBuffer  = b->Buffer();
-         SumBuffer(b->Length());
+         mr->fUpdates++;
          b->DetachBuffer();
          delete b;
+
+         ROOT::Internal::gMmallocDesc = 0;
+
+         ReleaseSemaphore();
+
+         SumBuffer(local.Length());
       }
       mr = mr->fNext;
    }
-
-   ROOT::Internal::gMmallocDesc = 0;
-
-   ReleaseSemaphore();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -766,48 +785,87 @@ void TMapFile::RemoveAll()
 /// be deleted after use. If delObj is a pointer to a previously allocated
 /// object it will be deleted. Returns 0 in case object with the given
 /// name does not exist.
+///
+/// The shared memory is only locked while the object buffer is copied,
+/// the object is then created from the private copy.
 
 TObject *TMapFile::Get(const char *name, TObject *delObj)
 {
    if (!fMmallocDesc) return 0;
 
-   AcquireSemaphore();
-
    delete delObj;
 
-   TObject *obj = 0;
+   TString clname;
+   Int_t bufsize = 0;
+   std::unique_ptr<char[]> buf;
+
+   AcquireSemaphore();
+
    TMapRec *mr = GetFirst();
    while (OrgAddress(mr)) {
       if (!strcmp(mr->GetName(fOffset), name)) {
-         if (!mr->fBufSize) goto release;
-         TClass *cl = TClass::GetClass(mr->GetClassName(fOffset));
-         if (!cl) {
-            Error("Get", "unknown class %s", mr->GetClassName(fOffset));
-            goto release;
+         if (mr->fBufSize) {
+            clname  = mr->GetClassName(fOffset);
+            bufsize = mr->fBufSize;
+            buf.reset(new char[bufsize]);
+            memcpy(buf.get(), mr->GetBuffer(fOffset), bufsize);
          }
+         break;
+      }
+      mr = mr->GetNext(fOffset);
+   }
 
-         obj = (TObject *)cl->New();
-         if (!obj) {
-            Error("Get", "cannot create new object of class %s", mr->GetClassName(fOffset));
-            goto release;
-         }
+   ReleaseSemaphore();
 
-         fGetting = obj;
-         TBufferFile *b = new TBufferFile(TBuffer::kRead, mr->fBufSize, mr->GetBuffer(fOffset));
-         b->MapObject(obj);  //register obj in map to handle self reference
-         obj->Streamer(*b);
-         b->DetachBuffer();
-         delete b;
-         fGetting = 0;
-         goto release;
+   if (!buf)
+      return 0;
+
+   TClass *cl = TClass::GetClass(clname);
+   if (!cl) {
+      Error("Get", "unknown class %s", clname.Data());
+      return 0;
+   }
+
+   TObject *obj = (TObject *)cl->New();
+   if (!obj) {
+      Error("Get", "cannot create new object of class %s", clname.Data());
+      return 0;
+   }
+
+   TBufferFile b(TBuffer::kRead, bufsize, buf.release());
+   b.MapObject(obj);  //register obj in map to handle self reference
+   obj->Streamer(b);
+
+   return obj;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return how many times the object with the given name was updated in
+/// shared memory, or -1 if there is no such object.
+///
+/// Allows consumers to call Get() only when the object has changed since
+/// it was last retrieved.
+
+Int_t TMapFile::GetUpdateCount(const char *name)
+{
+   if (!fMmallocDesc) return -1;
+
+   Int_t cnt = -1;
+
+   AcquireSemaphore();
+
+   TMapRec *mr = GetFirst();
+   while (OrgAddress(mr)) {
+      if (!strcmp(mr->GetName(fOffset), name)) {
+         cnt = mr->fUpdates;
+         break;
       }
       mr = mr->GetNext(fOffset);
    }
 
-release:
    ReleaseSemaphore();
 
-   return obj;
+   return cnt;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -25,6 +25,7 @@
 #include "TVirtualCollectionIterators.h"
 #include "TProcessID.h"
 #include "TFile.h"
+#include "ReadConvertFastArray.h"
 
 static const Int_t kRegrouped = TStreamerInfo::kOffsetL;
 
@@ -228,6 +229,27 @@ namespace TStreamerInfoActions
       return 0;
    }
 
+   template <typename T>
+   INLINE_TEMPLATE_ARGS Int_t ReadBasicTypeArray(TBuffer &buf, void *addr, const TConfiguration *config)
+   {
+      // Read a fixed size array of basic type, including the arrays
+      // made of consecutive data members regrouped by TStreamerInfo::Compile.
+      // This avoids going through the generic TStreamerInfo::ReadBuffer switch.
+      T *x = (T*)( ((char*)addr) + config->fOffset );
+      buf.ReadFastArray(x, config->fLength);
+      return 0;
+   }
+
+   template <typename T>
+   INLINE_TEMPLATE_ARGS Int_t WriteBasicTypeArray(TBuffer &buf, void *addr, const TConfiguration *config)
+   {
+      // Write a fixed size array of basic type, including the arrays
+      // made of consecutive data members regrouped by TStreamerInfo::Compile.
+      T *x = (T*)( ((char*)addr) + config->fOffset );
+      buf.WriteFastArray(x, config->fLength);
+      return 0;
+   }
+
    INLINE_TEMPLATE_ARGS Int_t WriteTextTNamed(TBuffer &buf, void *addr, const TConfiguration *config)
    {
       void *x = (void *)(((char *)addr) + config->fOffset);
@@ -1975,12 +1997,8 @@ namespace TStreamerInfoActions
             buf.ReadInt(nvalues);
             vec->resize(nvalues);
 
-            From *temp = new From[nvalues];
-            buf.ReadFastArray(temp, nvalues);
-            for(Int_t ind = 0; ind < nvalues; ++ind) {
-               (*vec)[ind] = (To)temp[ind];
-            }
-            delete [] temp;
+            ROOT::Internal::ReadConvertFastArray<From>(*vec, nvalues,
+               [&buf](From *temp, Int_t n) { buf.ReadFastArray(temp, n); });
 
             buf.CheckByteCount(start,count,config->fTypeName);
             return 0;
@@ -2002,12 +2020,8 @@ namespace TStreamerInfoActions
             buf.ReadInt(nvalues);
             vec->resize(nvalues);
 
-            From *temp = new From[nvalues];
-            buf.ReadFastArrayWithNbits(temp, nvalues, 0);
-            for(Int_t ind = 0; ind < nvalues; ++ind) {
-               (*vec)[ind] = (To)temp[ind];
-            }
-            delete [] temp;
+            ROOT::Internal::ReadConvertFastArray<From>(*vec, nvalues,
+               [&buf](From *temp, Int_t n) { buf.ReadFastArrayWithNbits(temp, n, 0); });
 
             buf.CheckByteCount(start,count,config->fTypeName);
             return 0;
@@ -2028,12 +2042,8 @@ namespace TStreamerInfoActions
          buf.ReadInt(nvalues);
          vec->resize(nvalues);
 
-         Double32_t *temp = new Double32_t[nvalues];
-         buf.ReadFastArrayDouble32(temp, nvalues);
-         for(Int_t ind = 0; ind < nvalues; ++ind) {
-            (*vec)[ind] = (To)temp[ind];
-         }
-         delete [] temp;
+         ROOT::Internal::ReadConvertFastArray<Double32_t>(*vec, nvalues,
+            [&buf](Double32_t *temp, Int_t n) { buf.ReadFastArrayDouble32(temp, n); });
 
          buf.CheckByteCount(start,count,config->fTypeName);
          return 0;
@@ -2252,13 +2262,8 @@ namespace TStreamerInfoActions
       struct ConvertRead {
          static INLINE_TEMPLATE_ARGS void Action(TBuffer &buf, void *addr, Int_t nvalues)
          {
-            From *temp = new From[nvalues];
-            buf.ReadFastArray(temp, nvalues);
-            To *vec = (To*)addr;
-            for(Int_t ind = 0; ind < nvalues; ++ind) {
-               vec[ind] = (To)temp[ind];
-            }
-            delete [] temp;
+            ROOT::Internal::ReadConvertFastArray<From>((To*)addr, nvalues,
+               [&buf](From *temp, Int_t n) { buf.ReadFastArray(temp, n); });
          }
       };
 
@@ -2266,13 +2271,8 @@ namespace TStreamerInfoActions
       struct ConvertRead<NoFactorMarker<From>,To> {
          static INLINE_TEMPLATE_ARGS void Action(TBuffer &buf, void *addr, Int_t nvalues)
          {
-            From *temp = new From[nvalues];
-            buf.ReadFastArrayWithNbits(temp, nvalues,0);
-            To *vec = (To*)addr;
-            for(Int_t ind = 0; ind < nvalues; ++ind) {
-               vec[ind] = (To)temp[ind];
-            }
-            delete [] temp;
+            ROOT::Internal::ReadConvertFastArray<From>((To*)addr, nvalues,
+               [&buf](From *temp, Int_t n) { buf.ReadFastArrayWithNbits(temp, n, 0); });
          }
       };
 
@@ -2280,14 +2280,9 @@ namespace TStreamerInfoActions
       struct ConvertRead<WithFactorMarker<From>,To> {
          static INLINE_TEMPLATE_ARGS void Action(TBuffer &buf, void *addr, Int_t nvalues)
          {
-            From *temp = new From[nvalues];
             double factor,min; // needs to be initialized.
-            buf.ReadFastArrayWithFactor(temp, nvalues, factor, min);
-            To *vec = (To*)addr;
-            for(Int_t ind = 0; ind < nvalues; ++ind) {
-               vec[ind] = (To)temp[ind];
-            }
-            delete [] temp;
+            ROOT::Internal::ReadConvertFastArray<From>((To*)addr, nvalues,
+               [&buf, &factor, &min](From *temp, Int_t n) { buf.ReadFastArrayWithFactor(temp, n, factor, min); });
          }
       };
 
@@ -3256,6 +3251,20 @@ void TStreamerInfo::AddReadAction(TStreamerInfoActions::TActionSequence *readSeq
          }
          break;
       }
+      // read fixed size arrays of basic types (and regrouped consecutive members)
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kBool:     readSequence->AddAction( ReadBasicTypeArray<Bool_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset,compinfo->fLength) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kChar:     readSequence->AddAction( ReadBasicTypeArray<Char_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset,compinfo->fLength) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kShort:    readSequence->AddAction( ReadBasicTypeArray<Short_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset,compinfo->fLength) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kInt:      readSequence->AddAction( ReadBasicTypeArray<Int_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset,compinfo->fLength) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kLong:     readSequence->AddAction( ReadBasicTypeArray<Long_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset,compinfo->fLength) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kLong64:   readSequence->AddAction( ReadBasicTypeArray<Long64_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset,compinfo->fLength) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kFloat:    readSequence->AddAction( ReadBasicTypeArray<Float_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset,compinfo->fLength) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kDouble:   readSequence->AddAction( ReadBasicTypeArray<Double_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset,compinfo->fLength) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kUChar:    readSequence->AddAction( ReadBasicTypeArray<UChar_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset,compinfo->fLength) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kUShort:   readSequence->AddAction( ReadBasicTypeArray<UShort_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset,compinfo->fLength) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kUInt:     readSequence->AddAction( ReadBasicTypeArray<UInt_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset,compinfo->fLength) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kULong:    readSequence->AddAction( ReadBasicTypeArray<ULong_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset,compinfo->fLength) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kULong64:  readSequence->AddAction( ReadBasicTypeArray<ULong64_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset,compinfo->fLength) ); break;
       case TStreamerInfo::kTNamed:  readSequence->AddAction( ReadTNamed, new TConfiguration(this,i,compinfo,compinfo->fOffset) );    break;
          // Idea: We should calculate the CanIgnoreTObjectStreamer here and avoid calling the
          // Streamer alltogether.
@@ -3552,6 +3561,20 @@ void TStreamerInfo::AddWriteAction(TStreamerInfoActions::TActionSequence *writeS
       case TStreamerInfo::kUInt:    writeSequence->AddAction( WriteBasicType<UInt_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset) );    break;
       case TStreamerInfo::kULong:   writeSequence->AddAction( WriteBasicType<ULong_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset) );   break;
       case TStreamerInfo::kULong64: writeSequence->AddAction( WriteBasicType<ULong64_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset) ); break;
+      // write fixed size arrays of basic types (and regrouped consecutive members)
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kBool:     writeSequence->AddAction( WriteBasicTypeArray<Bool_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset,compinfo->fLength) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kChar:     writeSequence->AddAction( WriteBasicTypeArray<Char_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset,compinfo->fLength) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kShort:    writeSequence->AddAction( WriteBasicTypeArray<Short_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset,compinfo->fLength) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kInt:      writeSequence->AddAction( WriteBasicTypeArray<Int_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset,compinfo->fLength) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kLong:     writeSequence->AddAction( WriteBasicTypeArray<Long_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset,compinfo->fLength) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kLong64:   writeSequence->AddAction( WriteBasicTypeArray<Long64_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset,compinfo->fLength) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kFloat:    writeSequence->AddAction( WriteBasicTypeArray<Float_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset,compinfo->fLength) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kDouble:   writeSequence->AddAction( WriteBasicTypeArray<Double_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset,compinfo->fLength) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kUChar:    writeSequence->AddAction( WriteBasicTypeArray<UChar_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset,compinfo->fLength) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kUShort:   writeSequence->AddAction( WriteBasicTypeArray<UShort_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset,compinfo->fLength) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kUInt:     writeSequence->AddAction( WriteBasicTypeArray<UInt_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset,compinfo->fLength) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kULong:    writeSequence->AddAction( WriteBasicTypeArray<ULong_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset,compinfo->fLength) ); break;
+      case TStreamerInfo::kOffsetL + TStreamerInfo::kULong64:  writeSequence->AddAction( WriteBasicTypeArray<ULong64_t>, new TConfiguration(this,i,compinfo,compinfo->fOffset,compinfo->fLength) ); break;
        // case TStreamerInfo::kBits:    writeSequence->AddAction( WriteBasicType<BitsMarker>, new TConfiguration(this,i,compinfo,compinfo->fOffset) );    break;
      /*case TStreamerInfo::kFloat16: {
          if (element->GetFactor() != 0) {
@@ -0,0 +1,121 @@
+#include "TBufferFile.h"
+
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+template <typename T>
+static void CheckRoundTrip(const std::vector<T> &values)
+{
+   const Int_t n = values.size();
+   TBufferFile wbuf(TBuffer::kWrite);
+   wbuf.WriteFastArray(values.data(), n);
+   ASSERT_EQ(wbuf.Length(), Int_t(n * sizeof(T)));
+
+   // The array must be laid out exactly like a sequence of single values.
+   TBufferFile sbuf(TBuffer::kWrite);
+   for (auto v : values)
+      sbuf << v;
+   ASSERT_EQ(wbuf.Length(), sbuf.Length());
+   EXPECT_EQ(0, memcmp(wbuf.Buffer(), sbuf.Buffer(), wbuf.Length()));
+
+   TBufferFile rbuf(TBuffer::kRead, wbuf.Length(), wbuf.Buffer(), kFALSE);
+   std::vector<T> read(n);
+   rbuf.ReadFastArray(read.data(), n);
+   EXPECT_EQ(values, read);
+   EXPECT_EQ(rbuf.Length(), wbuf.Length());
+}
+
+TEST(TBufferFileArray, BasicTypes)
+{
+   const Int_t n = 1001; // not a multiple of any vector width
+   std::vector<Short_t> s(n);
+   std::vector<UShort_t> us(n);
+   std::vector<Int_t> i(n);
+   std::vector<UInt_t> ui(n);
+   std::vector<Long64_t> l(n);
+   std::vector<ULong64_t> ul(n);
+   std::vector<Float_t> f(n);
+   std::vector<Double_t> d(n);
+   for (Int_t k = 0; k < n; ++k) {
+      s[k] = k * 37 - 20000;
+      us[k] = k * 61;
+      i[k] = k * 1234567 - 600000000;
+      ui[k] = k * 4000001u;
+      l[k] = k * 1234567890123LL - 600000000000000LL;
+      ul[k] = k * 98765432109876ULL;
+      f[k] = k * 0.37f - 100.f;
+      d[k] = k * 1.0e-3 - 0.5;
+   }
+   CheckRoundTrip(s);
+   CheckRoundTrip(us);
+   CheckRoundTrip(i);
+   CheckRoundTrip(ui);
+   CheckRoundTrip(l);
+   CheckRoundTrip(ul);
+   CheckRoundTrip(f);
+   CheckRoundTrip(d);
+}
+
+TEST(TBufferFileArray, Float16AndDouble32)
+{
+   const Int_t n = 513;
+   std::vector<Float_t> f(n);
+   std::vector<Double_t> d(n);
+   for (Int_t k = 0; k < n; ++k) {
+      f[k] = (k % 2 ? -1.f : 1.f) * k * 3.25f;
+      d[k] = (k % 3 ? -1. : 1.) * k * 0.125;
+   }
+
+   // Without a streamer element Float16_t keeps 12 bits of mantissa and
+   // Double32_t is stored as a float.
+   TBufferFile wbuf(TBuffer::kWrite);
+   wbuf.WriteFastArrayFloat16(f.data(), n, nullptr);
+   wbuf.WriteFastArrayDouble32(d.data(), n, nullptr);
+
+   TBufferFile sbuf(TBuffer::kWrite);
+   for (auto v : f)
+      sbuf.WriteFloat16(&v, nullptr);
+   for (auto v : d)
+      sbuf.WriteDouble32(&v, nullptr);
+   ASSERT_EQ(wbuf.Length(), sbuf.Length());
+   EXPECT_EQ(0, memcmp(wbuf.Buffer(), sbuf.Buffer(), wbuf.Length()));
+
+   TBufferFile rbuf(TBuffer::kRead, wbuf.Length(), wbuf.Buffer(), kFALSE);
+   std::vector<Float_t> rf(n);
+   std::vector<Double_t> rd(n);
+   rbuf.ReadFastArrayFloat16(rf.data(), n, nullptr);
+   rbuf.ReadFastArrayDouble32(rd.data(), n, nullptr);
+   for (Int_t k = 0; k < n; ++k) {
+      EXPECT_NEAR(f[k], rf[k], std::abs(f[k]) / 2048);
+      EXPECT_EQ((Float_t)d[k], rd[k]);
+   }
+}
+
+TEST(TBufferFileArray, WithFactorAndNbits)
+{
+   const Int_t n = 257;
+   std::vector<Double_t> d(n);
+   for (Int_t k = 0; k < n; ++k)
+      d[k] = k * 0.25 - 10.;
+
+   // Pack with a factor by hand to check the decoding of the array reader.
+   const Double_t xmin = -10., factor = 4.;
+   TBufferFile wbuf(TBuffer::kWrite);
+   for (auto v : d)
+      wbuf << UInt_t(0.5 + factor * (v - xmin));
+   for (auto v : d) {
+      Double_t x = v;
+      wbuf.WriteDouble32(&x, nullptr);
+   }
+
+   TBufferFile rbuf(TBuffer::kRead, wbuf.Length(), wbuf.Buffer(), kFALSE);
+   std::vector<Double_t> rd(n);
+   rbuf.ReadFastArrayWithFactor(rd.data(), n, factor, xmin);
+   EXPECT_EQ(d, rd);
+   std::vector<Double_t> rd2(n);
+   rbuf.ReadFastArrayWithNbits(rd2.data(), n, 0);
+   EXPECT_EQ(d, rd2);
+}
@@ -0,0 +1,46 @@
+#include "TBufferJSON.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+template <typename T>
+static void CheckRoundTrip(const std::vector<T> &values, Int_t compact)
+{
+   TString json = TBufferJSON::ToJSON(&values, compact);
+   std::vector<T> *read = nullptr;
+   ASSERT_TRUE(TBufferJSON::FromJSON(read, json.Data())) << json;
+   EXPECT_EQ(values, *read) << json;
+   delete read;
+}
+
+TEST(TBufferJSON, IntegralFloatingValues)
+{
+   std::vector<double> values = {0., 1., -1., 12345678., -9007199254740992., 1e20};
+   TString json = TBufferJSON::ToJSON(&values, 3);
+   EXPECT_EQ(TString("[0,1,-1,12345678,-9007199254740992,100000000000000000000]"), json);
+}
+
+TEST(TBufferJSON, Base64Arrays)
+{
+   std::vector<double> dvalues(1000, 0.);
+   for (int n = 100; n < 900; ++n)
+      dvalues[n] = 0.1 * n - 7;
+   std::vector<float> fvalues(dvalues.begin(), dvalues.end());
+   std::vector<int> ivalues(dvalues.begin(), dvalues.end());
+
+   TString json = TBufferJSON::ToJSON(&dvalues, 33);
+   EXPECT_NE(kNPOS, json.Index("\"b\":"));
+   EXPECT_NE(kNPOS, json.Index("\"p\":100"));
+
+   for (Int_t compact : {3, 13, 23, 33}) {
+      CheckRoundTrip(dvalues, compact);
+      CheckRoundTrip(fvalues, compact);
+      CheckRoundTrip(ivalues, compact);
+   }
+
+   // 64-bit integers are not base64-coded, compressed as with level 2
+   std::vector<Long64_t> lvalues(dvalues.begin(), dvalues.end());
+   EXPECT_EQ(kNPOS, TBufferJSON::ToJSON(&lvalues, 33).Index("\"b\":"));
+   CheckRoundTrip(lvalues, 33);
+}
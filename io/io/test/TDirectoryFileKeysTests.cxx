@@ -0,0 +1,36 @@
+#include "TFile.h"
+#include "TKey.h"
+#include "TNamed.h"
+#include "TSystem.h"
+
+#include <memory>
+
+#include "gtest/gtest.h"
+
+TEST(TDirectoryFile, ReadManyKeys)
+{
+   const char *fname = "tdirectoryfile_manykeys.root";
+   const Int_t nkeys = 5000;
+   {
+      TFile f(fname, "RECREATE");
+      for (Int_t i = 0; i < nkeys; ++i) {
+         TNamed n(TString::Format("obj%d", i), TString::Format("title%d", i));
+         f.WriteTObject(&n);
+      }
+   }
+
+   std::unique_ptr<TFile> f(TFile::Open(fname));
+   ASSERT_TRUE(f && !f->IsZombie());
+   EXPECT_EQ(nkeys, f->GetNkeys());
+   for (Int_t i : {0, 1, nkeys / 2, nkeys - 1}) {
+      TKey *key = f->GetKey(TString::Format("obj%d", i));
+      ASSERT_NE(nullptr, key);
+      std::unique_ptr<TNamed> n(key->ReadObject<TNamed>());
+      ASSERT_NE(nullptr, n.get());
+      EXPECT_STREQ(TString::Format("title%d", i), n->GetTitle());
+   }
+   EXPECT_EQ(nullptr, f->GetKey("notthere"));
+
+   f.reset();
+   gSystem->Unlink(fname);
+}
@@ -0,0 +1,90 @@
+#include "TFile.h"
+#include "TFileCacheWrite.h"
+#include "TNamed.h"
+#include "TString.h"
+#include "TSystem.h"
+
+#include <memory>
+
+#include "gtest/gtest.h"
+
+TEST(TFileCacheWrite, WriteBehind)
+{
+   const char *fname = "tfilecachewrite_writebehind.root";
+   const Int_t nobj = 500;
+   {
+      TFile f(fname, "RECREATE");
+      auto cache = new TFileCacheWrite(&f, 64 * 1024); // owned by the file
+      ASSERT_TRUE(cache->EnableWriteBehind(2));
+      EXPECT_TRUE(cache->IsWriteBehind());
+
+      TString title('x', 1000);
+      for (Int_t i = 0; i < nobj; ++i) {
+         TNamed n(TString::Format("obj%d", i), title + TString::Format("%d", i));
+         f.WriteTObject(&n);
+      }
+
+      // Reading back while writes are still queued must see the data.
+      TNamed *obj0 = nullptr;
+      f.GetObject("obj0", obj0);
+      std::unique_ptr<TNamed> first(obj0);
+      ASSERT_NE(first, nullptr);
+      EXPECT_EQ(title + "0", first->GetTitle());
+
+      f.Close();
+      EXPECT_FALSE(f.TestBit(TFile::kWriteError));
+   }
+
+   std::unique_ptr<TFile> f(TFile::Open(fname));
+   ASSERT_TRUE(f && !f->IsZombie());
+   TString title('x', 1000);
+   for (Int_t i = 0; i < nobj; ++i) {
+      TNamed *obj = nullptr;
+      f->GetObject(TString::Format("obj%d", i), obj);
+      std::unique_ptr<TNamed> n(obj);
+      ASSERT_NE(n, nullptr);
+      EXPECT_EQ(title + TString::Format("%d", i), n->GetTitle());
+   }
+   f.reset();
+   gSystem->Unlink(fname);
+}
+
+// Writes queued after TFile::ReOpen must go to the new descriptor of the file.
+TEST(TFileCacheWrite, WriteBehindReOpen)
+{
+   const char *fname = "tfilecachewrite_reopen.root";
+   const Int_t nobj = 200;
+   TString title('y', 1000);
+   {
+      TFile f(fname, "RECREATE");
+      auto cache = new TFileCacheWrite(&f, 64 * 1024); // owned by the file
+      ASSERT_TRUE(cache->EnableWriteBehind(2));
+      for (Int_t i = 0; i < nobj; ++i) {
+         TNamed n(TString::Format("a%d", i), title);
+         f.WriteTObject(&n);
+      }
+      ASSERT_EQ(0, f.ReOpen("READ"));
+      ASSERT_EQ(0, f.ReOpen("UPDATE"));
+      EXPECT_TRUE(cache->IsWriteBehind());
+      for (Int_t i = 0; i < nobj; ++i) {
+         TNamed n(TString::Format("b%d", i), title);
+         f.WriteTObject(&n);
+      }
+      f.Close();
+      EXPECT_FALSE(f.TestBit(TFile::kWriteError));
+   }
+
+   std::unique_ptr<TFile> f(TFile::Open(fname));
+   ASSERT_TRUE(f && !f->IsZombie());
+   for (const char *prefix : {"a", "b"}) {
+      for (Int_t i = 0; i < nobj; ++i) {
+         TNamed *obj = nullptr;
+         f->GetObject(TString::Format("%s%d", prefix, i), obj);
+         std::unique_ptr<TNamed> n(obj);
+         ASSERT_NE(n, nullptr) << prefix << i;
+         EXPECT_EQ(title, n->GetTitle());
+      }
+   }
+   f.reset();
+   gSystem->Unlink(fname);
+}
@@ -0,0 +1,139 @@
+#include "RConfig.h"
+#include "TFile.h"
+#include "TKey.h"
+#include "TNamed.h"
+#include "TSystem.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+TEST(TFileReadBuffer, PositionedReadKeepsCursor)
+{
+   const char *fname = "tfile_readbuffer_test.root";
+   {
+      TFile f(fname, "RECREATE");
+      TNamed n("name", "title");
+      f.WriteTObject(&n);
+   }
+
+   std::unique_ptr<TFile> f(TFile::Open(fname));
+   ASSERT_TRUE(f && !f->IsZombie());
+
+   char head[5] = {0};
+   f->Seek(0);
+   ASSERT_FALSE(f->ReadBuffer(head, 2));
+   EXPECT_EQ(0, strncmp(head, "ro", 2));
+
+   // A positioned read must return the data at the requested offset ...
+   char magic[5] = {0};
+   ASSERT_FALSE(f->ReadBuffer(magic, 0, 4));
+   EXPECT_STREQ("root", magic);
+#ifndef R__WIN32
+   EXPECT_EQ(2, f->GetRelOffset()); // positioned reads keep the file offset
+#endif
+
+   // ... and sequential reads must continue where they stopped.
+   ASSERT_FALSE(f->ReadBuffer(head + 2, 2));
+   EXPECT_STREQ("root", head);
+#ifndef R__WIN32
+   EXPECT_EQ(4, f->GetRelOffset()); // advanced by the sequential reads
+#endif
+
+   Long64_t pos[2] = {0, 2};
+   Int_t len[2] = {2, 2};
+   char multi[5] = {0};
+   ASSERT_FALSE(f->ReadBuffers(multi, pos, len, 2));
+   EXPECT_STREQ("root", multi);
+
+   f.reset();
+   gSystem->Unlink(fname);
+}
+
+TEST(TFileReadBuffer, PositionedReadOnlyWhenReadOnly)
+{
+   const char *fname = "tfile_readbuffer_update_test.root";
+   {
+      TFile f(fname, "RECREATE");
+      EXPECT_FALSE(f.IsPositionedRead());
+      TNamed n("name", "title");
+      f.WriteTObject(&n);
+   }
+
+   std::unique_ptr<TFile> f(TFile::Open(fname, "UPDATE"));
+   ASSERT_TRUE(f && !f->IsZombie());
+   // Writes go through the file offset: the reads of a writable file must use it too.
+   EXPECT_FALSE(f->IsPositionedRead());
+   EXPECT_FALSE(f->SetSharedRead());
+
+   char magic[5] = {0};
+   ASSERT_FALSE(f->ReadBuffer(magic, 0, 4));
+   EXPECT_STREQ("root", magic);
+
+   f.reset();
+   gSystem->Unlink(fname);
+}
+
+#if defined(R__USE_IMT) && !defined(R__WIN32)
+TEST(TFileReadBuffer, SharedRead)
+{
+   const char *fname = "tfile_readbuffer_shared_test.root";
+   const int nObjects = 16;
+   {
+      TFile f(fname, "RECREATE");
+      for (int i = 0; i < nObjects; ++i) {
+         TNamed n(TString::Format("name%d", i), TString::Format("title%d", i));
+         f.WriteTObject(&n);
+      }
+   }
+
+   std::unique_ptr<TFile> f(TFile::Open(fname));
+   ASSERT_TRUE(f && !f->IsZombie());
+   ASSERT_TRUE(f->IsPositionedRead());
+   ASSERT_TRUE(f->SetSharedRead());
+   EXPECT_TRUE(f->IsSharedRead());
+
+   // The keys are read once, then their buffers from several threads at once.
+   std::vector<TKey *> keys;
+   for (auto obj : *f->GetListOfKeys())
+      keys.push_back(static_cast<TKey *>(obj));
+   ASSERT_EQ(nObjects, (int)keys.size());
+
+   const int nThreads = 4;
+   std::atomic<int> nErrors{0};
+   auto readKeys = [&](int ithread) {
+      for (int iter = 0; iter < 50; ++iter) {
+         for (int i = 0; i < nObjects; ++i) {
+            TKey *key = keys[(i + ithread) % nObjects];
+            std::vector<char> buffer(key->GetNbytes());
+            char magic[5] = {0};
+            if (f->ReadBuffer(buffer.data(), key->GetSeekKey(), key->GetNbytes()) ||
+                f->ReadBuffer(magic, 0, 4) || strcmp(magic, "root"))
+               ++nErrors;
+            // the key name is stored in the key header
+            else if (std::search(buffer.begin(), buffer.end(), key->GetName(),
+                                 key->GetName() + strlen(key->GetName())) == buffer.end())
+               ++nErrors;
+         }
+      }
+   };
+
+   std::vector<std::thread> threads;
+   for (int i = 0; i < nThreads; ++i)
+      threads.emplace_back(readKeys, i);
+   for (auto &t : threads)
+      t.join();
+   EXPECT_EQ(0, nErrors.load());
+
+   ASSERT_TRUE(f->SetSharedRead(kFALSE));
+   EXPECT_FALSE(f->IsSharedRead());
+
+   f.reset();
+   gSystem->Unlink(fname);
+}
+#endif
@@ -0,0 +1,40 @@
+#include "TH1.h"
+#include "TMapFile.h"
+#include "TSystem.h"
+
+#include <memory>
+
+#include "gtest/gtest.h"
+
+TEST(TMapFile, UpdateAndGet)
+{
+   const char *fname = "tmapfile_updateandget.map";
+   TMapFile *mfile = TMapFile::Create(fname, "RECREATE", 1000000, "test map file");
+   ASSERT_NE(nullptr, mfile);
+
+   TH1F h("h", "h", 100, -3., 3.);
+   mfile->Add(&h, "h");
+   EXPECT_EQ(0, mfile->GetUpdateCount("h"));
+   EXPECT_EQ(-1, mfile->GetUpdateCount("unknown"));
+   EXPECT_EQ(nullptr, mfile->Get("h")); // not streamed into the shared memory yet
+
+   for (Int_t i = 0; i < 1000; ++i)
+      h.Fill(-3. + 0.006 * i);
+   mfile->Update();
+   EXPECT_EQ(1, mfile->GetUpdateCount("h"));
+
+   std::unique_ptr<TH1F> copy((TH1F *)mfile->Get("h"));
+   ASSERT_NE(nullptr, copy);
+   EXPECT_EQ(1000, copy->GetEntries());
+   EXPECT_DOUBLE_EQ(h.GetMean(), copy->GetMean());
+
+   h.Fill(1.);
+   mfile->Update(&h);
+   EXPECT_EQ(2, mfile->GetUpdateCount("h"));
+   copy.reset((TH1F *)mfile->Get("h"));
+   ASSERT_NE(nullptr, copy);
+   EXPECT_EQ(1001, copy->GetEntries());
+
+   mfile->Close();
+   gSystem->Unlink(fname);
+}
@@ -365,6 +365,11 @@ namespace FitUtil {
    */
    double EvaluatePoissonBinPdf(const IModelFunction & func, const BinData & data, const double * x, unsigned int ipoint, double * g = 0);
 
+   /**
+       number of chunks used to split nEvents in the multi-threaded evaluations when it is not given
+       explicitly. It depends only on nEvents (and not on the number of threads), so that the partial
+       sums, and therefore the results, are the same for any size of the thread pool
+   */
    unsigned setAutomaticChunking(unsigned nEvents);
 
    template<class T>
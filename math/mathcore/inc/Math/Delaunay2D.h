@@ -95,6 +95,11 @@ public:
    /// Return the Interpolated z value corresponding to the (x,y) point
    double  Interpolate(double x, double y);
 
+   /// Interpolate the z values at the n points (x[i],y[i]) and store them in z.
+   /// The triangles are found only once and the points are evaluated in parallel
+   /// when the implicit multi-threading is enabled
+   void    InterpolateN(int n, const double *x, const double *y, double *z);
+
    /// Find all triangles 
    void      FindAllTriangles();
 
@@ -136,6 +141,10 @@ private:
    /// internal method to compute the interpolation
    double  DoInterpolateNormalized(double x, double y);
 
+   /// internal method to compute the interpolation at a (x,y) point
+   /// once all the triangles have been found
+   double  DoInterpolate(double x, double y);
+
 
    
 private:
@@ -264,12 +273,17 @@ protected:
    /* To speed up localisation of points a grid is layed over normalized space
     *
     * A reference to triangle ABC is added to _all_ grid cells that include ABC's bounding box
+    *
+    * The number of cells grows with the number of points, so that a cell contains on average
+    * only a few triangles. The triangles of cell c are stored, in increasing order, in
+    * fCellTriangles[fCellStart[c]] ... fCellTriangles[fCellStart[c+1]-1]
     */
 
-   static const int fNCells = 25; //! number of cells to divide the normalized space
+   int fNCells; //! number of cells to divide the normalized space
    double fXCellStep; //! inverse denominator to calculate X cell = fNCells / (fXNmax - fXNmin)
    double fYCellStep; //! inverse denominator to calculate X cell = fNCells / (fYNmax - fYNmin)
-   std::set<UInt_t> fCells[(fNCells+1)*(fNCells+1)]; //! grid cells with containing triangles
+   std::vector<UInt_t> fCellStart;     //! index of the first triangle of each grid cell in fCellTriangles
+   std::vector<UInt_t> fCellTriangles; //! triangles contained in the grid cells
 
    inline unsigned int Cell(UInt_t x, UInt_t y) const {
 	   return x*(fNCells+1) + y;
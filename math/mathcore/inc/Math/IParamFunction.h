@@ -127,6 +127,17 @@ namespace ROOT {
             return DoEval(x);
          }
 
+         /**
+            Evaluate the function at n points for the given parameters p.
+            The coordinates of the points are stored one after the other in x (n * NDim() values)
+            and the n function values are written in result.
+            Use the virtual function DoEvalN, which by default evaluates the points one by one
+         */
+         void EvalN(unsigned int n, const T *x, T *result, const double *p) const
+         {
+            DoEvalN(n, x, result, p);
+         }
+
       private:
          /**
             Implementation of the evaluation function using the x values and the parameters.
@@ -141,6 +152,17 @@ namespace ROOT {
          {
             return DoEvalPar(x, Parameters());
          }
+
+         /**
+            Implementation of the evaluation at n points. Derived classes can re-implement it
+            when many points can be evaluated more efficiently in a single call
+         */
+         virtual void DoEvalN(unsigned int n, const T *x, T *result, const double *p) const
+         {
+            const unsigned int ndim = this->NDim();
+            for (unsigned int i = 0; i < n; ++i)
+               result[i] = DoEvalPar(x + i * ndim, p);
+         }
       };
 
 
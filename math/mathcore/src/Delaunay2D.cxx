@@ -23,8 +23,15 @@
 #endif
 
 #include <algorithm>
+#include <cmath>
 #include <stdlib.h>
 
+#ifdef R__USE_IMT
+#include "TROOT.h"
+#include "ROOT/TThreadExecutor.hxx"
+#include "ROOT/TSeq.hxx"
+#endif
+
 namespace ROOT {
    
    namespace Math {
@@ -95,6 +102,7 @@ void Delaunay2D::SetInputPoints(int n, const double * x, const double * y, const
 
 
 #ifndef HAS_CGAL
+   fNCells       = 25;
    fXCellStep    = 0.;
    fYCellStep    = 0.;
 #endif
@@ -111,6 +119,41 @@ double Delaunay2D::Interpolate(double x, double y)
    // needed in this function.
    FindAllTriangles();
 
+   return DoInterpolate(x, y);
+}
+
+//______________________________________________________________________________
+void Delaunay2D::InterpolateN(int n, const double *x, const double *y, double *z)
+{
+   // Return the z values corresponding to the n points (x[i],y[i])
+
+   FindAllTriangles();
+
+#if defined(R__USE_IMT) && !defined(HAS_CGAL)
+   // once the triangles are found the interpolation does not modify the object
+   // and the points can be evaluated concurrently, in chunks of points
+   const int chunkSize = 1024;
+   if (ROOT::IsImplicitMTEnabled() && n > chunkSize) {
+      const unsigned int nChunks = (n + chunkSize - 1) / chunkSize;
+      auto interpolateChunk = [&](unsigned int ichunk) {
+         const int first = ichunk * chunkSize;
+         const int last = std::min(n, first + chunkSize);
+         for (int i = first; i < last; ++i)
+            z[i] = DoInterpolate(x[i], y[i]);
+      };
+      ROOT::TThreadExecutor pool;
+      pool.Foreach(interpolateChunk, ROOT::TSeq<unsigned int>(0, nChunks));
+      return;
+   }
+#endif
+
+   for (int i = 0; i < n; ++i)
+      z[i] = DoInterpolate(x[i], y[i]);
+}
+
+//______________________________________________________________________________
+double Delaunay2D::DoInterpolate(double x, double y)
+{
    // Find the z value corresponding to the point (x,y).
    double xx, yy;
    xx = Linear_transform(x, fOffsetX, fScaleFactorX); //xx = xTransformer(x);
@@ -242,11 +285,17 @@ double Delaunay2D::DoInterpolateNormalized(double xx, double yy)
 
 /// Triangle implementation for normalizing the points
 void Delaunay2D::DoNormalizePoints() {
+   fXN.clear();
+   fYN.clear();
    for (Int_t n = 0; n < fNpoints; n++) {
       fXN.push_back(Linear_transform(fX[n], fOffsetX, fScaleFactorX));
       fYN.push_back(Linear_transform(fY[n], fOffsetY, fScaleFactorY));
    }
 
+   // use about one cell per point (there are about two triangles per point),
+   // so that each cell contains only a few triangles
+   fNCells = std::max(25, std::min(1000, int(std::sqrt(double(fNpoints)))));
+
    //also initialize fXCellStep and FYCellStep
    fXCellStep = fNCells / (fXNmax - fXNmin);
    fYCellStep = fNCells / (fYNmax - fYNmin);
@@ -323,6 +372,25 @@ void Delaunay2D::DoFindTriangles() {
 
    triangulate((char *) "zQN", &in, &out, nullptr);
 
+   // number of triangles in each grid cell, used to fill the cell index
+   std::vector<UInt_t> cellCount((fNCells+1)*(fNCells+1), 0);
+   auto forEachCell = [&] (const Triangle & tri, std::function<void(unsigned int)> func) {
+      auto bx = std::minmax({tri.x[0], tri.x[1], tri.x[2]});
+      auto by = std::minmax({tri.y[0], tri.y[1], tri.y[2]});
+
+      unsigned int cellXmin = CellX(bx.first);
+      unsigned int cellXmax = CellX(bx.second);
+
+      unsigned int cellYmin = CellY(by.first);
+      unsigned int cellYmax = CellY(by.second);
+
+      for(unsigned int i = cellXmin; i <= cellXmax; ++i) {
+         for(unsigned int j = cellYmin; j <= cellYmax; ++j) {
+            func(Cell(i,j));
+         }
+      }
+   };
+
    fTriangles.resize(out.numberoftriangles);
    for(int t = 0; t < out.numberoftriangles; ++t){
       Triangle tri;
@@ -352,23 +420,18 @@ void Delaunay2D::DoFindTriangles() {
 
       fTriangles[t] = tri;
 
-      auto bx = std::minmax({tri.x[0], tri.x[1], tri.x[2]});
-      auto by = std::minmax({tri.y[0], tri.y[1], tri.y[2]});
-
-      unsigned int cellXmin = CellX(bx.first);
-      unsigned int cellXmax = CellX(bx.second);
-
-      unsigned int cellYmin = CellY(by.first);
-      unsigned int cellYmax = CellY(by.second);
-
-      for(unsigned int i = cellXmin; i <= cellXmax; ++i) {
-         for(unsigned int j = cellYmin; j <= cellYmax; ++j) {
-            //printf("(%u,%u) = %u\n", i, j, Cell(i,j));
-            fCells[Cell(i,j)].insert(t);
-         }
-      }
+      forEachCell(tri, [&] (unsigned int c) { ++cellCount[c]; });
    }
 
+   // fill the triangles of each cell, in increasing triangle order, in a single array
+   fCellStart.assign(cellCount.size() + 1, 0);
+   for(unsigned int c = 0; c < cellCount.size(); ++c)
+      fCellStart[c+1] = fCellStart[c] + cellCount[c];
+   fCellTriangles.resize(fCellStart.back());
+   std::copy(fCellStart.begin(), fCellStart.end() - 1, cellCount.begin());
+   for(unsigned int t = 0; t < fTriangles.size(); ++t)
+      forEachCell(fTriangles[t], [&] (unsigned int c) { fCellTriangles[cellCount[c]++] = t; });
+
    freeStruct(in); freeStruct(out);
 }
 
@@ -402,7 +465,9 @@ double Delaunay2D::DoInterpolateNormalized(double xx, double yy)
    if(cX < 0 || cX > fNCells || cY < 0 || cY > fNCells)
       return fZout; //TODO some more fancy interpolation here
 
-    for(unsigned int t : fCells[Cell(cX, cY)]){
+    const unsigned int cell = Cell(cX, cY);
+    for(unsigned int k = fCellStart[cell]; k < fCellStart[cell+1]; ++k){
+       const unsigned int t = fCellTriangles[k];
        auto coords = bayCoords(t);
 
        if(inTriangle(coords)){
@@ -425,14 +490,14 @@ double Delaunay2D::DoInterpolateNormalized(double xx, double yy)
           //brute force found a triangle -> grid not
           printf("Found triangle %u for (%f,%f) -> (%u,%u)\n", t, xx,yy, cX, cY);
           printf("Triangles in grid cell: ");
-          for(unsigned int x : fCells[Cell(cX, cY)])
-             printf("%u ", x);
+          for(unsigned int k = fCellStart[Cell(cX, cY)]; k < fCellStart[Cell(cX, cY)+1]; ++k)
+             printf("%u ", fCellTriangles[k]);
           printf("\n");
 
           printf("Triangle %u is in cells: ", t);
           for(unsigned int i = 0; i <= fNCells; ++i)
              for(unsigned int j = 0; j <= fNCells; ++j)
-                if(fCells[Cell(i,j)].count(t))
+                if(std::count(&fCellTriangles[fCellStart[Cell(i,j)]], &fCellTriangles[fCellStart[Cell(i,j)+1]], t))
                    printf("(%u,%u) ", i, j);
           printf("\n");
           for(unsigned int i = 0; i < 3; ++i)
@@ -213,6 +213,41 @@ namespace ROOT {
             }
          }
 
+#ifdef R__USE_IMT
+         // parallel map-reduce of mapFunction(igEval, i) over the n data points
+         // the points are split in nChunks contiguous ranges which depend only on n and nChunks
+         // (and not on the number of threads) and the partial results are reduced in range order,
+         // so the result is reproducible. Each chunk uses its own IntegralEvaluator since the
+         // numerical integrators used for the bin integrals are not thread safe
+         template <class MapFunc, class RedFunc>
+         auto MapReduceChunks(const IModelFunction &func, const double *p, bool useBinIntegral,
+                              const MapFunc &mapFunction, const RedFunc &redFunction, unsigned int n,
+                              unsigned int nChunks) -> decltype(mapFunction(std::declval<IntegralEvaluator<> &>(), 0u))
+         {
+            using Result_t = decltype(mapFunction(std::declval<IntegralEvaluator<> &>(), 0u));
+            if (n == 0)
+               return redFunction(std::vector<Result_t>());
+            if (nChunks == 0 || nChunks > n)
+               nChunks = (nChunks == 0) ? 1 : n;
+            const unsigned int step = (n + nChunks - 1) / nChunks;
+            const unsigned int nActualChunks = (n + step - 1) / step;
+
+            auto chunkFunction = [&](unsigned int ichunk) {
+               IntegralEvaluator<> igEval(func, p, useBinIntegral);
+               const unsigned int ibegin = ichunk * step;
+               const unsigned int iend = std::min(n, ibegin + step);
+               std::vector<Result_t> partialResults;
+               partialResults.reserve(iend - ibegin);
+               for (unsigned int i = ibegin; i < iend; ++i)
+                  partialResults.push_back(mapFunction(igEval, i));
+               return redFunction(partialResults);
+            };
+
+            ROOT::TThreadExecutor pool;
+            return redFunction(pool.Map(chunkFunction, ROOT::TSeq<unsigned>(0, nActualChunks)));
+         }
+#endif
+
 
 
       } // end namespace  FitUtil
@@ -257,11 +292,6 @@ namespace ROOT {
    if (isWeighted)   std::cout << "Weighted data set - sumw =  " << data.SumOfContent() << "  sumw2 = " << data.SumOfError2() << std::endl;
 #endif
 
-#ifdef USE_PARAMCACHE
-   IntegralEvaluator<> igEval( func, 0, useBinIntegral);
-#else
-   IntegralEvaluator<> igEval( func, p, useBinIntegral);
-#endif
    double maxResValue = std::numeric_limits<double>::max() /n;
    double wrefVolume = 1.0;
    if (useBinVolume) {
@@ -270,7 +300,13 @@ namespace ROOT {
 
    (const_cast<IModelFunction &>(func)).SetParameters(p);
 
-   auto mapFunction = [&](const unsigned i){
+   // when the bin integral is not used the function values are computed before
+   // for all the points with IModelFunction::EvalN, which allows to evaluate
+   // the model (e.g. a TF1 formula) in a vectorized way
+   bool useEvalN = !useBinIntegral && n > 0 && func.NDim() == data.NDim();
+   std::vector<double> fvals;
+
+   auto mapFunction = [&](IntegralEvaluator<> &igEval, const unsigned i){
 
       double chi2{};
       double fval{};
@@ -307,7 +343,10 @@ namespace ROOT {
       }
 
 
-      if (!useBinIntegral) {
+      if (useEvalN) {
+         fval = fvals[i];
+      }
+      else if (!useBinIntegral) {
 #ifdef USE_PARAMCACHE
          fval = func ( x );
 #else
@@ -383,16 +422,59 @@ namespace ROOT {
   }
 #endif
 
+  if (useEvalN) {
+     const unsigned int ndim = data.NDim();
+     fvals.resize(n);
+     // EvalN expects the coordinates of the points one after the other
+     const double *xall = nullptr;
+     std::vector<double> xcoords;
+     if (ndim == 1 && !useBinVolume) {
+        xall = data.GetCoordComponent(0, 0);
+     } else {
+        xcoords.resize(n * ndim);
+        for (unsigned int i = 0; i < n; ++i) {
+           const double *x2 = (useBinVolume) ? data.BinUpEdge(i) : nullptr;
+           for (unsigned int j = 0; j < ndim; ++j) {
+              double xx = *data.GetCoordComponent(i, j);
+              xcoords[i * ndim + j] = (useBinVolume) ? 0.5 * (x2[j] + xx) : xx;
+           }
+        }
+        xall = xcoords.data();
+     }
+     auto evalChunk = [&](unsigned int ibegin, unsigned int iend) {
+        if (iend > ibegin)
+           func.EvalN(iend - ibegin, xall + ibegin * ndim, fvals.data() + ibegin, p);
+     };
+#ifdef R__USE_IMT
+     if (executionPolicy == ROOT::Fit::ExecutionPolicy::kMultithread) {
+        ROOT::TThreadExecutor pool;
+        unsigned int nEvalChunks = nChunks != 0 ? nChunks : setAutomaticChunking(n);
+        unsigned int chunkSize = (n + nEvalChunks - 1) / nEvalChunks;
+        // the first chunk is evaluated before entering the parallel region, so that the model
+        // prepares its batched evaluation (e.g. jitting it with Cling) from a single thread
+        evalChunk(0, std::min(n, chunkSize));
+        if (nEvalChunks > 1)
+           pool.Foreach([&](unsigned int ichunk) { evalChunk(ichunk * chunkSize, std::min(n, (ichunk + 1) * chunkSize)); },
+                        ROOT::TSeq<unsigned>(1, nEvalChunks));
+     } else
+#endif
+        evalChunk(0, n);
+  }
+
   double res{};
   if(executionPolicy == ROOT::Fit::ExecutionPolicy::kSerial){
+#ifdef USE_PARAMCACHE
+    IntegralEvaluator<> igEval( func, 0, useBinIntegral);
+#else
+    IntegralEvaluator<> igEval( func, p, useBinIntegral);
+#endif
     for (unsigned int i=0; i<n; ++i) {
-      res += mapFunction(i);
+      res += mapFunction(igEval, i);
     }
 #ifdef R__USE_IMT
   } else if(executionPolicy == ROOT::Fit::ExecutionPolicy::kMultithread) {
-    ROOT::TThreadExecutor pool;
     auto chunks = nChunks !=0? nChunks: setAutomaticChunking(data.Size());
-    res = pool.MapReduce(mapFunction, ROOT::TSeq<unsigned>(0, n), redFunction, chunks);
+    res = MapReduceChunks(func, p, useBinIntegral, mapFunction, redFunction, n, chunks);
 #endif
 //   } else if(executionPolicy == ROOT::Fit::kMultitProcess){
     // ROOT::TProcessExecutor pool;
@@ -669,14 +751,12 @@ void FitUtil::EvaluateChi2Gradient(const IModelFunction &f, const BinData &data,
       if (fitOpt.fNormBinVolume) wrefVolume /= data.RefVolume();
    }
 
-   IntegralEvaluator<> igEval(func, p, useBinIntegral);
-
    unsigned int npar = func.NPar();
    unsigned initialNPoints = data.Size();
 
    std::vector<bool> isPointRejected(initialNPoints);
 
-   auto mapFunction = [&](const unsigned int i) {
+   auto mapFunction = [&](IntegralEvaluator<> &igEval, const unsigned int i) {
       // set all vector values to zero
       std::vector<double> gradFunc(npar);
       std::vector<double> pointContribution(npar);
@@ -794,17 +874,17 @@ void FitUtil::EvaluateChi2Gradient(const IModelFunction &f, const BinData &data,
 #endif
 
    if (executionPolicy == ROOT::Fit::ExecutionPolicy::kSerial) {
+      IntegralEvaluator<> igEval(func, p, useBinIntegral);
       std::vector<std::vector<double>> allGradients(initialNPoints);
       for (unsigned int i = 0; i < initialNPoints; ++i) {
-         allGradients[i] = mapFunction(i);
+         allGradients[i] = mapFunction(igEval, i);
       }
       g = redFunction(allGradients);
    }
 #ifdef R__USE_IMT
    else if (executionPolicy == ROOT::Fit::ExecutionPolicy::kMultithread) {
-      ROOT::TThreadExecutor pool;
       auto chunks = nChunks != 0 ? nChunks : setAutomaticChunking(initialNPoints);
-      g = pool.MapReduce(mapFunction, ROOT::TSeq<unsigned>(0, initialNPoints), redFunction, chunks);
+      g = MapReduceChunks(func, p, useBinIntegral, mapFunction, redFunction, initialNPoints, chunks);
    }
 #endif
    // else if(executionPolicy == ROOT::Fit::kMultiprocess){
@@ -1409,13 +1489,7 @@ double FitUtil::EvaluatePoissonLogL(const IModelFunction &func, const BinData &d
              << useBinVolume << " useW2 " << useW2 << " wrefVolume = " << wrefVolume << std::endl;
 #endif
 
-#ifdef USE_PARAMCACHE
-   IntegralEvaluator<> igEval(func, 0, useBinIntegral);
-#else
-   IntegralEvaluator<> igEval(func, p, useBinIntegral);
-#endif
-
-   auto mapFunction = [&](const unsigned i) {
+   auto mapFunction = [&](IntegralEvaluator<> &igEval, const unsigned i) {
       auto x1 = data.GetCoordComponent(i, 0);
       auto y = *data.ValuePtr(i);
 
@@ -1536,14 +1610,18 @@ double FitUtil::EvaluatePoissonLogL(const IModelFunction &func, const BinData &d
 
    double res{};
    if (executionPolicy == ROOT::Fit::ExecutionPolicy::kSerial) {
+#ifdef USE_PARAMCACHE
+      IntegralEvaluator<> igEval(func, 0, useBinIntegral);
+#else
+      IntegralEvaluator<> igEval(func, p, useBinIntegral);
+#endif
       for (unsigned int i = 0; i < n; ++i) {
-         res += mapFunction(i);
+         res += mapFunction(igEval, i);
       }
 #ifdef R__USE_IMT
    } else if (executionPolicy == ROOT::Fit::ExecutionPolicy::kMultithread) {
-      ROOT::TThreadExecutor pool;
       auto chunks = nChunks != 0 ? nChunks : setAutomaticChunking(data.Size());
-      res = pool.MapReduce(mapFunction, ROOT::TSeq<unsigned>(0, n), redFunction, chunks);
+      res = MapReduceChunks(func, p, useBinIntegral, mapFunction, redFunction, n, chunks);
 #endif
       //   } else if(executionPolicy == ROOT::Fit::kMultitProcess){
       // ROOT::TProcessExecutor pool;
@@ -1582,12 +1660,10 @@ void FitUtil::EvaluatePoissonLogLGradient(const IModelFunction &f, const BinData
    if (useBinVolume && fitOpt.fNormBinVolume)
       wrefVolume /= data.RefVolume();
 
-   IntegralEvaluator<> igEval(func, p, useBinIntegral);
-
    unsigned int npar = func.NPar();
    unsigned initialNPoints = data.Size();
 
-   auto mapFunction = [&](const unsigned int i) {
+   auto mapFunction = [&](IntegralEvaluator<> &igEval, const unsigned int i) {
       // set all vector values to zero
       std::vector<double> gradFunc(npar);
       std::vector<double> pointContribution(npar);
@@ -1704,17 +1780,17 @@ void FitUtil::EvaluatePoissonLogLGradient(const IModelFunction &f, const BinData
 #endif
 
    if (executionPolicy == ROOT::Fit::ExecutionPolicy::kSerial) {
+      IntegralEvaluator<> igEval(func, p, useBinIntegral);
       std::vector<std::vector<double>> allGradients(initialNPoints);
       for (unsigned int i = 0; i < initialNPoints; ++i) {
-         allGradients[i] = mapFunction(i);
+         allGradients[i] = mapFunction(igEval, i);
       }
       g = redFunction(allGradients);
    }
 #ifdef R__USE_IMT
    else if (executionPolicy == ROOT::Fit::ExecutionPolicy::kMultithread) {
-      ROOT::TThreadExecutor pool;
       auto chunks = nChunks != 0 ? nChunks : setAutomaticChunking(initialNPoints);
-      g = pool.MapReduce(mapFunction, ROOT::TSeq<unsigned>(0, initialNPoints), redFunction, chunks);
+      g = MapReduceChunks(func, p, useBinIntegral, mapFunction, redFunction, initialNPoints, chunks);
    }
 #endif
 
@@ -1745,10 +1821,13 @@ void FitUtil::EvaluatePoissonLogLGradient(const IModelFunction &f, const BinData
 
 
 unsigned FitUtil::setAutomaticChunking(unsigned nEvents){
-      auto ncpu  = ROOT::GetImplicitMTPoolSize();
-      if (nEvents/ncpu < 1000) return ncpu;
-      return nEvents/1000;
-      //return ((nEvents/ncpu + 1) % 1000) *40 ; //arbitrary formula
+      // do not use the pool size here: the splitting of the data in chunks determines
+      // the order of the floating point sums, which must not depend on the number of threads.
+      // Use chunks of about 1000 events and at least kMinChunks chunks to keep all the
+      // threads busy for small data sets
+      constexpr unsigned kMinChunks = 64;
+      if (nEvents == 0) return 1;
+      return std::max(std::min(nEvents, kMinChunks), (nEvents + 999) / 1000);
 }
 
 }
@@ -367,14 +367,14 @@ bool Fitter::DoLeastSquareFit(const ROOT::Fit::ExecutionPolicy &executionPolicy)
          if (fFunc_v) {
             std::shared_ptr<IGradModelFunction_v> gradFun = std::dynamic_pointer_cast<IGradModelFunction_v>(fFunc_v);
             if (gradFun) {
-               Chi2FCN<BaseGradFunc, IModelFunction_v> chi2(data, gradFun);
+               Chi2FCN<BaseGradFunc, IModelFunction_v> chi2(data, gradFun, executionPolicy);
                fFitType = chi2.Type();
                return DoMinimization(chi2);
             }
          } else {
             std::shared_ptr<IGradModelFunction> gradFun = std::dynamic_pointer_cast<IGradModelFunction>(fFunc);
             if (gradFun) {
-               Chi2FCN<BaseGradFunc> chi2(data, gradFun);
+               Chi2FCN<BaseGradFunc> chi2(data, gradFun, executionPolicy);
                fFitType = chi2.Type();
                return DoMinimization(chi2);
             }
@@ -418,7 +418,7 @@ bool Fitter::DoBinnedLikelihoodFit(bool extended, const ROOT::Fit::ExecutionPoli
       // do minimization without using the gradient
       if (fFunc_v) {
          // create a chi2 function to be used for the equivalent chi-square
-         Chi2FCN<BaseFunc, IModelFunction_v> chi2(data, fFunc_v);
+         Chi2FCN<BaseFunc, IModelFunction_v> chi2(data, fFunc_v, executionPolicy);
          PoissonLikelihoodFCN<BaseFunc, IModelFunction_v> logl(data, fFunc_v, useWeight, extended, executionPolicy);
          fFitType = logl.Type();
          // do minimization
@@ -431,7 +431,7 @@ bool Fitter::DoBinnedLikelihoodFit(bool extended, const ROOT::Fit::ExecutionPoli
          }
       } else {
          // create a chi2 function to be used for the equivalent chi-square
-         Chi2FCN<BaseFunc> chi2(data, fFunc);
+         Chi2FCN<BaseFunc> chi2(data, fFunc, executionPolicy);
          PoissonLikelihoodFCN<BaseFunc> logl(data, fFunc, useWeight, extended, executionPolicy);
          fFitType = logl.Type();
          // do minimization
@@ -446,7 +446,7 @@ bool Fitter::DoBinnedLikelihoodFit(bool extended, const ROOT::Fit::ExecutionPoli
    } else {
       if (fFunc_v) {
          // create a chi2 function to be used for the equivalent chi-square
-         Chi2FCN<BaseFunc, IModelFunction_v> chi2(data, fFunc_v);
+         Chi2FCN<BaseFunc, IModelFunction_v> chi2(data, fFunc_v, executionPolicy);
          std::shared_ptr<IGradModelFunction_v> gradFun = std::dynamic_pointer_cast<IGradModelFunction_v>(fFunc_v);
          if (!gradFun) {
             MATH_ERROR_MSG("Fitter::DoBinnedLikelihoodFit", "wrong type of function - it does not provide gradient");
@@ -464,7 +464,7 @@ bool Fitter::DoBinnedLikelihoodFit(bool extended, const ROOT::Fit::ExecutionPoli
          }
       } else {
          // create a chi2 function to be used for the equivalent chi-square
-         Chi2FCN<BaseFunc> chi2(data, fFunc);
+         Chi2FCN<BaseFunc> chi2(data, fFunc, executionPolicy);
          if (fConfig.MinimizerOptions().PrintLevel() > 0)
             MATH_INFO_MSG("Fitter::DoLikelihoodFit", "use gradient from model function");
          // check if fFunc provides gradient
@@ -559,7 +559,7 @@ bool Fitter::DoUnbinnedLikelihoodFit(bool extended, const ROOT::Fit::ExecutionPo
                MATH_WARN_MSG("Fitter::DoUnbinnedLikelihoodFit",
                              "Extended unbinned fit with gradient not yet supported - do a not-extended fit");
             }
-            LogLikelihoodFCN<BaseGradFunc, IModelFunction_v> logl(data, gradFun, useWeight, extended);
+            LogLikelihoodFCN<BaseGradFunc, IModelFunction_v> logl(data, gradFun, useWeight, extended, executionPolicy);
             fFitType = logl.Type();
             if (!DoMinimization(logl))
                return false;
@@ -581,7 +581,7 @@ bool Fitter::DoUnbinnedLikelihoodFit(bool extended, const ROOT::Fit::ExecutionPo
                MATH_WARN_MSG("Fitter::DoUnbinnedLikelihoodFit",
                              "Extended unbinned fit with gradient not yet supported - do a not-extended fit");
             }
-            LogLikelihoodFCN<BaseGradFunc> logl(data, gradFun, useWeight, extended);
+            LogLikelihoodFCN<BaseGradFunc> logl(data, gradFun, useWeight, extended, executionPolicy);
             fFitType = logl.Type();
             if (!DoMinimization(logl))
                return false;
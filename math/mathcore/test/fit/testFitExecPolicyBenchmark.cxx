@@ -0,0 +1,169 @@
+// Benchmark of the serial and multi-threaded evaluation of the fit objective functions
+// for typical fits of histograms (chi2, binned likelihood, with and without the bin integral
+// option and the parameter gradient), graphs and unbinned data.
+// It checks also that the multi-threaded results agree with the serial ones and that they are
+// reproducible (the same chunking is used independently of the number of threads)
+
+#include "TH1.h"
+#include "TF1.h"
+#include "TGraph.h"
+#include "TRandom.h"
+#include "TFitResult.h"
+#include "TError.h"
+#include "TROOT.h"
+#include "Fit/Fitter.h"
+#include "Fit/UnBinData.h"
+#include "Math/WrappedMultiTF1.h"
+#include "Math/MinimizerOptions.h"
+
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+
+double tolerance = 0.01;
+
+struct FitBenchmark {
+   std::string name;
+   // perform the fit with the given execution policy and return the minimum of the FCN (NaN in case of failure)
+   std::function<double(ROOT::Fit::ExecutionPolicy)> fit;
+   double serialTime = 0;
+   double mtTime = 0;
+};
+
+double timeFit(FitBenchmark &bench, ROOT::Fit::ExecutionPolicy policy, double &fcnValue)
+{
+   auto start = std::chrono::system_clock::now();
+   fcnValue = bench.fit(policy);
+   auto end = std::chrono::system_clock::now();
+   std::chrono::duration<double> duration = end - start;
+   return duration.count();
+}
+
+// run a fit benchmark and check the results. Return false in case of failure
+bool runBenchmark(FitBenchmark &bench)
+{
+   std::cout << "\n **" << bench.name << " Fit**\n";
+   double serialValue = 0;
+   bench.serialTime = timeFit(bench, ROOT::Fit::ExecutionPolicy::kSerial, serialValue);
+   if (std::isnan(serialValue)) {
+      Error("testFitExecPolicyBenchmark", "%s serial fit failed!", bench.name.c_str());
+      return false;
+   }
+   std::cout << "Time for the sequential fit: " << bench.serialTime << std::endl;
+
+#ifdef R__USE_IMT
+   double mtValue = 0;
+   double mtValue2 = 0;
+   bench.mtTime = timeFit(bench, ROOT::Fit::ExecutionPolicy::kMultithread, mtValue);
+   timeFit(bench, ROOT::Fit::ExecutionPolicy::kMultithread, mtValue2);
+   if (std::isnan(mtValue) || std::isnan(mtValue2)) {
+      Error("testFitExecPolicyBenchmark", "%s multi-threaded fit failed!", bench.name.c_str());
+      return false;
+   }
+   std::cout << "Time for the multi-threaded fit: " << bench.mtTime << std::endl;
+
+   if (std::abs(mtValue - serialValue) > tolerance * std::abs(serialValue)) {
+      Error("testFitExecPolicyBenchmark", "%s : Failed comparison of fit results \t FCN = %f, it should be = %f",
+            bench.name.c_str(), mtValue, serialValue);
+      return false;
+   }
+   if (mtValue != mtValue2) {
+      Error("testFitExecPolicyBenchmark", "%s : multi-threaded fit is not reproducible \t FCN = %.17g and %.17g",
+            bench.name.c_str(), mtValue, mtValue2);
+      return false;
+   }
+#endif
+   return true;
+}
+
+void printSpeedUps(const std::vector<FitBenchmark> &benchmarks)
+{
+   std::cout << std::endl << "\n   ***Speedups of the multi-threaded fits***" << std::endl;
+   std::cout.precision(2);
+   for (auto &b : benchmarks) {
+      std::cout << b.name << std::string(b.name.size() < 40 ? 40 - b.name.size() : 1, ' ') << "|  " << std::fixed
+                << ((b.mtTime > 0) ? b.serialTime / b.mtTime : 0.) << std::endl;
+   }
+   std::cout << std::endl;
+}
+
+int main()
+{
+#ifdef R__USE_IMT
+   ROOT::EnableImplicitMT();
+#endif
+   ROOT::Math::MinimizerOptions::SetDefaultMinimizer("Minuit2");
+
+   TF1 f("fBench", "gaus(0) + expo(3)", 0, 10);
+   auto resetParams = [&]() { f.SetParameters(900, 4, 1, 5, -0.3); };
+   resetParams();
+
+   gRandom->SetSeed(1);
+   TH1D hLarge("hLarge", "Large histogram", 10001, 0, 10);
+   hLarge.FillRandom("fBench", 1000000);
+   TH1D hSmall("hSmall", "Histogram for the integral fits", 500, 0, 10);
+   hSmall.FillRandom("fBench", 100000);
+
+   // graph from the content of the large histogram
+   std::vector<double> gx, gy;
+   for (int i = 1; i <= hLarge.GetNbinsX(); ++i) {
+      gx.push_back(hLarge.GetBinCenter(i));
+      gy.push_back(hLarge.GetBinContent(i));
+   }
+   TGraph gr(gx.size(), gx.data(), gy.data());
+
+   // unbinned data from a normalized gaussian
+   TF1 fPdf("fPdf", "exp(-0.5*((x-[0])/[1])^2)/(sqrt(2*pi)*[1])", -10, 10);
+   const unsigned int nUnbinned = 500000;
+   ROOT::Fit::UnBinData unbinData(nUnbinned);
+   for (unsigned int i = 0; i < nUnbinned; ++i)
+      unbinData.Add(gRandom->Gaus(0.5, 2.));
+
+   auto histFit = [&](TH1 &h, std::string opt) {
+      return [&h, &f, opt, resetParams](ROOT::Fit::ExecutionPolicy policy) {
+         resetParams();
+         std::string option = opt + " Q S N " +
+                              ((policy == ROOT::Fit::ExecutionPolicy::kSerial) ? "SERIAL" : "MULTITHREAD");
+         auto result = h.Fit(&f, option.c_str());
+         return ((Int_t)result == 0) ? result->MinFcnValue() : std::numeric_limits<double>::quiet_NaN();
+      };
+   };
+
+   std::vector<FitBenchmark> benchmarks;
+   benchmarks.push_back({"TH1 Chi2", histFit(hLarge, "")});
+   benchmarks.push_back({"TH1 Chi2 with gradient", histFit(hLarge, "G")});
+   benchmarks.push_back({"TH1 Binned Likelihood", histFit(hLarge, "L")});
+   benchmarks.push_back({"TH1 Binned Likelihood with gradient", histFit(hLarge, "L G")});
+   benchmarks.push_back({"TH1 Chi2 with bin integral", histFit(hSmall, "I")});
+   benchmarks.push_back({"TH1 Binned Likelihood with bin integral", histFit(hSmall, "L I")});
+
+   benchmarks.push_back({"TGraph Chi2", [&](ROOT::Fit::ExecutionPolicy policy) {
+                            resetParams();
+                            std::string option = "Q S N ";
+                            option += (policy == ROOT::Fit::ExecutionPolicy::kSerial) ? "SERIAL" : "MULTITHREAD";
+                            auto result = gr.Fit(&f, option.c_str());
+                            return ((Int_t)result == 0) ? result->MinFcnValue() : std::numeric_limits<double>::quiet_NaN();
+                         }});
+
+   benchmarks.push_back({"UnBinData Likelihood", [&](ROOT::Fit::ExecutionPolicy policy) {
+                            fPdf.SetParameters(0., 1.);
+                            ROOT::Fit::Fitter fitter;
+                            fitter.SetFunction(ROOT::Math::WrappedMultiTF1(fPdf, 1), false);
+                            if (!fitter.LikelihoodFit(unbinData, false, policy))
+                               return std::numeric_limits<double>::quiet_NaN();
+                            return fitter.Result().MinFcnValue();
+                         }});
+
+   bool ok = true;
+   for (auto &b : benchmarks)
+      ok &= runBenchmark(b);
+
+#ifdef R__USE_IMT
+   printSpeedUps(benchmarks);
+#endif
+   return (ok) ? 0 : 1;
+}
@@ -13,6 +13,7 @@
 #include "Minuit2/MnConfig.h"
 #include "Minuit2/MnMatrix.h"
 
+#include <atomic>
 #include <vector>
 
 namespace ROOT {
@@ -56,7 +57,8 @@ private:
 
 protected:
 
-  mutable int fNumCall;
+  // atomic since the function can be called concurrently when computing the derivatives in parallel
+  mutable std::atomic<int> fNumCall;
 };
 
   }  // namespace Minuit2
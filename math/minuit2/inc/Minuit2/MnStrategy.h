@@ -49,6 +49,8 @@ public:
 
    int StorageLevel() const { return fStoreLevel; }
 
+   bool ParallelDerivatives() const { return fParallelDerivatives; }
+
    bool IsLow() const {return fStrategy == 0;}
    bool IsMedium() const {return fStrategy == 1;}
    bool IsHigh() const {return fStrategy >= 2;}
@@ -69,6 +71,11 @@ public:
    // set storage level of iteration quantities
    // 0 = store only last iterations 1 = full storage (default)
    void SetStorageLevel(unsigned int level) { fStoreLevel = level; }
+
+   // compute the numerical derivatives with respect to the different parameters
+   // (gradient and Hessian elements) in parallel using the ROOT thread pool.
+   // It requires a thread-safe FCN and it is ignored when ROOT is built without IMT
+   void SetParallelDerivatives(bool on = true) { fParallelDerivatives = on; }
 private:
 
    unsigned int fStrategy;
@@ -81,6 +88,7 @@ private:
    double fHessTlrG2;
    unsigned int fHessGradNCyc;
    int fStoreLevel;
+   bool fParallelDerivatives;
 };
 
   }  // namespace Minuit2
@@ -26,6 +26,10 @@
 
 #include "Minuit2/MPIProcess.h"
 
+#ifdef MINUIT2_USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#endif
+
 namespace ROOT {
 
    namespace Minuit2 {
@@ -70,7 +74,6 @@ std::pair<FunctionGradient, MnAlgebraicVector> HessianGradientCalculator::DeltaG
    // calculate gradient for Hessian
    assert(par.IsValid());
 
-   MnAlgebraicVector x = par.Vec();
    MnAlgebraicVector grd = Gradient.Grad();
    const MnAlgebraicVector& g2 = Gradient.G2();
    //const MnAlgebraicVector& gstep = Gradient.Gstep();
@@ -82,15 +85,11 @@ std::pair<FunctionGradient, MnAlgebraicVector> HessianGradientCalculator::DeltaG
 
    double dfmin = 4.*Precision().Eps2()*(fabs(fcnmin)+Fcn().Up());
 
-   unsigned int n = x.size();
+   unsigned int n = par.Vec().size();
    MnAlgebraicVector dgrd(n);
 
-   MPIProcess mpiproc(n,0);
-   // initial starting values
-   unsigned int startElementIndex = mpiproc.StartElementIndex();
-   unsigned int endElementIndex = mpiproc.EndElementIndex();
-
-   for(unsigned int i = startElementIndex; i < endElementIndex; i++) {
+   // compute the derivative with respect to the parameter i (x is modified and restored)
+   auto computeDerivative = [&](unsigned int i, MnAlgebraicVector &x) {
       double xtf = x(i);
       double dmin = 4.*Precision().Eps2()*(xtf + Precision().Eps2());
       double epspri = Precision().Eps2() + fabs(grd(i)*Precision().Eps2());
@@ -135,11 +134,35 @@ std::pair<FunctionGradient, MnAlgebraicVector> HessianGradientCalculator::DeltaG
       std::cout << "HGC Param : " << i << "\t new g1 = " << grd(i) << " gstep = " << d << " dgrd = " << dgrd(i) << std::endl;
 #endif
 
+   };
+
+#ifdef MINUIT2_USE_IMT
+   // parallelize the loop on the parameters using the ROOT thread pool (FCN must be thread safe)
+   if (Strategy().ParallelDerivatives() && n > 1) {
+      ROOT::TThreadExecutor pool;
+      pool.Foreach([&](unsigned int i) {
+                      MnAlgebraicVector x = par.Vec();
+                      computeDerivative(i, x);
+                   },
+                   ROOT::TSeq<unsigned int>(0, n));
    }
+   else
+#endif
+   {
+      MnAlgebraicVector x = par.Vec();
 
-   mpiproc.SyncVector(grd);
-   mpiproc.SyncVector(gstep);
-   mpiproc.SyncVector(dgrd);
+      MPIProcess mpiproc(n,0);
+      // initial starting values
+      unsigned int startElementIndex = mpiproc.StartElementIndex();
+      unsigned int endElementIndex = mpiproc.EndElementIndex();
+
+      for(unsigned int i = startElementIndex; i < endElementIndex; i++)
+         computeDerivative(i, x);
+
+      mpiproc.SyncVector(grd);
+      mpiproc.SyncVector(gstep);
+      mpiproc.SyncVector(dgrd);
+   }
 
    return std::pair<FunctionGradient, MnAlgebraicVector>(FunctionGradient(grd, g2, gstep), dgrd);
 }
@@ -467,6 +467,11 @@ bool Minuit2Minimizer::Minimize() {
       bool ret = minuit2Opt->GetValue("StorageLevel",storageLevel);
       if (ret) SetStorageLevel(storageLevel);
 
+      // compute the numerical derivatives in parallel (requires a thread-safe FCN)
+      int parallelDerivatives = 0;
+      minuit2Opt->GetValue("ParallelDerivatives",parallelDerivatives);
+      strategy.SetParallelDerivatives(parallelDerivatives != 0);
+
       if (printLevel > 0) {
          std::cout << "Minuit2Minimizer::Minuit  - Changing default options" << std::endl;
          minuit2Opt->Print();
@@ -1054,7 +1059,15 @@ bool Minuit2Minimizer::Hesse( ) {
    // set the precision if needed
    if (Precision() > 0) fState.SetPrecision(Precision());
 
-   ROOT::Minuit2::MnHesse hesse( strategy );
+   ROOT::Minuit2::MnStrategy hesseStrategy(strategy);
+   ROOT::Math::IOptions * minuit2Opt = ROOT::Math::MinimizerOptions::FindDefault("Minuit2");
+   if (minuit2Opt) {
+      int parallelDerivatives = 0;
+      minuit2Opt->GetValue("ParallelDerivatives",parallelDerivatives);
+      hesseStrategy.SetParallelDerivatives(parallelDerivatives != 0);
+   }
+
+   ROOT::Minuit2::MnHesse hesse( hesseStrategy );
 
 
    // case when function minimum exists
@@ -30,6 +30,10 @@
 
 #include "Minuit2/MPIProcess.h"
 
+#ifdef MINUIT2_USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#endif
+
 namespace ROOT {
 
    namespace Minuit2 {
@@ -130,9 +134,26 @@ MinimumState MnHesse::operator()(const MnFcn& mfcn, const MinimumState& st, cons
 #endif
 
 
-   for(unsigned int i = 0; i < n; i++) {
+#ifdef MINUIT2_USE_IMT
+   // compute the derivatives w.r.t the different parameters in parallel (FCN must be thread safe)
+   const bool runParallel = fStrategy.ParallelDerivatives() && n > 1;
+#endif
+
+   // in case of failure return a diagonal matrix from the second derivatives
+   auto failedState = [&]() {
+      for(unsigned int j = 0; j < n; j++) {
+         double tmp = g2(j) < prec.Eps2() ? 1. : 1./g2(j);
+         vhmat(j,j) = tmp < prec.Eps2() ? 1. : tmp;
+      }
 
-      double xtf = x(i);
+      return MinimumState(st.Parameters(), MinimumError(vhmat, MinimumError::MnHesseFailed()), st.Gradient(), st.Edm(), mfcn.NumOfCalls());
+   };
+
+   // compute the diagonal element i (xv is modified and restored).
+   // Return false if the second derivative is zero
+   auto computeDiagonal = [&](unsigned int i, MnAlgebraicVector &xv) {
+
+      double xtf = xv(i);
       double dmin = 8.*prec.Eps2()*(fabs(xtf) + prec.Eps2());
       double d = fabs(gst(i));
       if(d < dmin) d = dmin;
@@ -147,20 +168,20 @@ MinimumState MnHesse::operator()(const MnFcn& mfcn, const MinimumState& st, cons
          double fs1 = 0.;
          double fs2 = 0.;
          for(unsigned int multpy = 0; multpy < 5; multpy++) {
-            x(i) = xtf + d;
-            fs1 = mfcn(x);
-            x(i) = xtf - d;
-            fs2 = mfcn(x);
-            x(i) = xtf;
+            xv(i) = xtf + d;
+            fs1 = mfcn(xv);
+            xv(i) = xtf - d;
+            fs2 = mfcn(xv);
+            xv(i) = xtf;
             sag = 0.5*(fs1+fs2-2.*amin);
 
 #ifdef DEBUG
             std::cout << "cycle " << icyc << " mul " << multpy << "\t sag = " << sag << " d = " << d << std::endl;
 #endif
             //  Now as F77 Minuit - check taht sag is not zero
-            if (sag != 0) goto L30; // break
+            if (sag != 0) break;
             if(trafo.Parameter(i).HasLimits()) {
-               if(d > 0.5) goto L26;
+               if(d > 0.5) break;
                d *= 10.;
                if(d > 0.5) d = 0.51;
                continue;
@@ -168,27 +189,9 @@ MinimumState MnHesse::operator()(const MnFcn& mfcn, const MinimumState& st, cons
             d *= 10.;
          }
 
-L26:
-#ifdef WARNINGMSG
-
-         // get parameter name for i
-         // (need separate scope for avoiding compl error when declaring name)
-         {
-            const char * name = trafo.Name( trafo.ExtOfInt(i));
-            MN_INFO_VAL2("MnHesse: 2nd derivative zero for Parameter ", name);
-            MN_INFO_MSG("MnHesse fails and will return diagonal matrix ");
-         }
-#endif
-
-         for(unsigned int j = 0; j < n; j++) {
-            double tmp = g2(j) < prec.Eps2() ? 1. : 1./g2(j);
-            vhmat(j,j) = tmp < prec.Eps2() ? 1. : tmp;
-         }
-
-         return MinimumState(st.Parameters(), MinimumError(vhmat, MinimumError::MnHesseFailed()), st.Gradient(), st.Edm(), mfcn.NumOfCalls());
+         if (sag == 0) return false;
 
-L30:
-            double g2bfor = g2(i);
+         double g2bfor = g2(i);
          g2(i) = 2.*sag/(d*d);
          grd(i) = (fs1-fs2)/(2.*d);
          gst(i) = d;
@@ -212,22 +215,52 @@ L30:
          d = std::max(d, 0.1*dlast);
       }
       vhmat(i,i) = g2(i);
-      if(mfcn.NumOfCalls()  > maxcalls) {
+      return true;
+   };
 
+   // report a zero second derivative
+   auto zeroDerivativeFailure = [&](unsigned int i) {
 #ifdef WARNINGMSG
-         //std::cout<<"maxcalls " << maxcalls << " " << mfcn.NumOfCalls() << "  " <<   st.NFcn() << std::endl;
-         MN_INFO_MSG("MnHesse: maximum number of allowed function calls exhausted.");
-         MN_INFO_MSG("MnHesse fails and will return diagonal matrix ");
+      // get parameter name for i
+      const char * name = trafo.Name( trafo.ExtOfInt(i));
+      MN_INFO_VAL2("MnHesse: 2nd derivative zero for Parameter ", name);
+      MN_INFO_MSG("MnHesse fails and will return diagonal matrix ");
+#else
+      (void)i;
 #endif
+      return failedState();
+   };
 
-         for(unsigned int j = 0; j < n; j++) {
-            double tmp = g2(j) < prec.Eps2() ? 1. : 1./g2(j);
-            vhmat(j,j) = tmp < prec.Eps2() ? 1. : tmp;
-         }
-
-         return MinimumState(st.Parameters(), MinimumError(vhmat, MinimumError::MnHesseFailed()), st.Gradient(), st.Edm(), mfcn.NumOfCalls());
+   auto maxCallsFailure = [&]() {
+#ifdef WARNINGMSG
+      //std::cout<<"maxcalls " << maxcalls << " " << mfcn.NumOfCalls() << "  " <<   st.NFcn() << std::endl;
+      MN_INFO_MSG("MnHesse: maximum number of allowed function calls exhausted.");
+      MN_INFO_MSG("MnHesse fails and will return diagonal matrix ");
+#endif
+      return failedState();
+   };
+
+#ifdef MINUIT2_USE_IMT
+   if (runParallel) {
+      std::vector<int> diagonalOk(n);
+      ROOT::TThreadExecutor pool;
+      pool.Foreach([&](unsigned int i) {
+                      MnAlgebraicVector xi = st.Parameters().Vec();
+                      diagonalOk[i] = computeDiagonal(i, xi);
+                   },
+                   ROOT::TSeq<unsigned int>(0, n));
+      for(unsigned int i = 0; i < n; i++) {
+         if (!diagonalOk[i]) return zeroDerivativeFailure(i);
+      }
+      if(mfcn.NumOfCalls()  > maxcalls) return maxCallsFailure();
+   }
+   else
+#endif
+   {
+      for(unsigned int i = 0; i < n; i++) {
+         if (!computeDiagonal(i, x)) return zeroDerivativeFailure(i);
+         if(mfcn.NumOfCalls()  > maxcalls) return maxCallsFailure();
       }
-
    }
 
 #ifdef DEBUG
@@ -244,6 +277,24 @@ L30:
    }
 
    //off-diagonal Elements
+#ifdef MINUIT2_USE_IMT
+   if (runParallel) {
+      // one task for each row of the matrix
+      ROOT::TThreadExecutor pool;
+      pool.Foreach([&](unsigned int i) {
+                      MnAlgebraicVector xi = st.Parameters().Vec();
+                      xi(i) += dirin(i);
+                      for (unsigned int j = i + 1; j < n; j++) {
+                         xi(j) += dirin(j);
+                         double fs1 = mfcn(xi);
+                         vhmat(i,j) = (fs1 + amin - yy(i) - yy(j))/(dirin(i)*dirin(j));
+                         xi(j) -= dirin(j);
+                      }
+                   },
+                   ROOT::TSeq<unsigned int>(0, n - 1));
+   }
+   else
+#endif
    // initial starting values
    if (n > 0) { 
       MPIProcess mpiprocOffDiagonal(n*(n-1)/2,0);
@@ -33,6 +33,10 @@
 
 #include "Minuit2/MPIProcess.h"
 
+#ifdef MINUIT2_USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#endif
+
 namespace ROOT {
 
    namespace Minuit2 {
@@ -100,10 +104,6 @@ FunctionGradient Numerical2PGradientCalculator::operator()(const MinimumParamete
    MnAlgebraicVector g2 = Gradient.G2();
    MnAlgebraicVector gstep = Gradient.Gstep();
 
-#ifndef _OPENMP
-   MPIProcess mpiproc(n,0);
-#endif
-
 #ifdef DEBUG
    std::cout << "Calculating Gradient at x =   " << par.Vec() << std::endl;
    int pr = std::cout.precision(13);
@@ -111,37 +111,15 @@ FunctionGradient Numerical2PGradientCalculator::operator()(const MinimumParamete
    std::cout.precision(pr);
 #endif
 
-#ifndef _OPENMP
-   // for serial execution this can be outside the loop
-   MnAlgebraicVector x = par.Vec();
-
-   unsigned int startElementIndex = mpiproc.StartElementIndex();
-   unsigned int endElementIndex = mpiproc.EndElementIndex();
-
-   for(unsigned int i = startElementIndex; i < endElementIndex; i++) {
-
-#else
-
- // parallelize this loop using OpenMP
-//#define N_PARALLEL_PAR 5
-#pragma omp parallel
-#pragma omp for
-//#pragma omp for schedule (static, N_PARALLEL_PAR)
-
-   for(int i = 0; i < int(n); i++) {
-
-#endif
+   // compute the derivative with respect to the parameter i. The vector x is modified
+   // during the computation and restored at the end: each thread must use its own copy
+   auto computeDerivative = [&](unsigned int i, MnAlgebraicVector &x) {
 
 #ifdef DEBUG_MP
       int ith = omp_get_thread_num();
       //std::cout << "Thread number " << ith << "  " << i << std::endl;
 #endif
 
-#ifdef _OPENMP
-       // create in loop since each thread will use its own copy
-      MnAlgebraicVector x = par.Vec();
-#endif
-
       double xtf = x(i);
       double epspri = eps2 + fabs(grd(i)*eps2);
       double stepb4 = 0.;
@@ -217,13 +195,51 @@ FunctionGradient Numerical2PGradientCalculator::operator()(const MinimumParamete
       std::cout << "Parameter " << Trafo().Name(iext) << " Gradient =   " << grd(i) << " g2 = " << g2(i) << " step " << gstep(i) << std::endl;
       std::cout.precision(pr);
 #endif
+   };
+
+#ifdef MINUIT2_USE_IMT
+   // parallelize the loop on the parameters using the ROOT thread pool (FCN must be thread safe)
+   if (Strategy().ParallelDerivatives() && n > 1) {
+      ROOT::TThreadExecutor pool;
+      pool.Foreach([&](unsigned int i) {
+                      MnAlgebraicVector x = par.Vec();
+                      computeDerivative(i, x);
+                   },
+                   ROOT::TSeq<unsigned int>(0, n));
    }
-
+   else
+#endif
+   {
 #ifndef _OPENMP
-   mpiproc.SyncVector(grd);
-   mpiproc.SyncVector(g2);
-   mpiproc.SyncVector(gstep);
+      MPIProcess mpiproc(n,0);
+
+      // for serial execution this can be outside the loop
+      MnAlgebraicVector x = par.Vec();
+
+      unsigned int startElementIndex = mpiproc.StartElementIndex();
+      unsigned int endElementIndex = mpiproc.EndElementIndex();
+
+      for(unsigned int i = startElementIndex; i < endElementIndex; i++)
+         computeDerivative(i, x);
+
+      mpiproc.SyncVector(grd);
+      mpiproc.SyncVector(g2);
+      mpiproc.SyncVector(gstep);
+#else
+
+    // parallelize this loop using OpenMP
+//#define N_PARALLEL_PAR 5
+#pragma omp parallel
+#pragma omp for
+//#pragma omp for schedule (static, N_PARALLEL_PAR)
+
+      for(int i = 0; i < int(n); i++) {
+         // create in loop since each thread will use its own copy
+         MnAlgebraicVector x = par.Vec();
+         computeDerivative(i, x);
+      }
 #endif
+   }
 
 #ifdef DEBUG
    std::cout << "Calculated Gradient at x =   " << par.Vec() << std::endl;
@@ -13,6 +13,8 @@
 #include "Minuit2/MnUserParameterState.h"
 #include "Minuit2/MnPrint.h"
 #include "Minuit2/MnMigrad.h"
+#include "Minuit2/MnHesse.h"
+#include "Minuit2/MnStrategy.h"
 #include "Minuit2/MnMinos.h"
 #include "Minuit2/MnPlot.h"
 #include "Minuit2/MinosError.h"
@@ -116,6 +118,22 @@ int doFit(int ndim, int ndata) {
   // output
   std::cout<<"minimum: "<<min<<std::endl;
 
+  // redo the fit computing the gradient and the Hessian elements for the different parameters
+  // in parallel using the ROOT thread pool (ignored if ROOT is built without IMT support)
+  MnStrategy parStrategy(1);
+  parStrategy.SetParallelDerivatives(true);
+  MnMigrad migrad(fcn, MnUserParameterState(init_par, init_err), parStrategy);
+  FunctionMinimum parMin = migrad();
+  MnHesse hesse(parStrategy);
+  hesse(fcn, parMin);
+
+  std::cout<<"minimum with parallel derivatives: "<<parMin<<std::endl;
+
+  if (!parMin.IsValid() || std::abs(parMin.Fval() - min.Fval()) > 1.E-6 * std::abs(min.Fval()) ) {
+     std::cout << "Error: result with parallel derivatives is different: " << parMin.Fval() << " instead of " << min.Fval() << std::endl;
+     return 1;
+  }
+
 
 //     // create MINOS Error factory
 //     MnMinos Minos(fFCN, min);
@@ -154,5 +172,5 @@ int main(int argc, char **argv) {
       ndata = atoi(argv[2] );
    }
    std::cout << "do fit of " << ndim << " dimensional data on " << ndata << " events " << std::endl;
-   doFit(ndim,ndata);
+   return doFit(ndim,ndata);
 }
@@ -17,6 +17,7 @@
 #include "TNamed.h"
 #include "THttpCallArg.h"
 
+#include <atomic>
 #include <mutex>
 #include <map>
 #include <string>
@@ -26,6 +27,7 @@
 
 class THttpEngine;
 class THttpTimer;
+class THttpCacheEntry;
 class TRootSniffer;
 
 class THttpServer : public TNamed {
@@ -58,6 +60,18 @@ protected:
    std::mutex fWSMutex;                                      ///<! mutex to protect WS handler lists
    std::vector<std::shared_ptr<THttpWSHandler>> fWSHandlers; ///<! list of WS handlers
 
+   std::mutex fCacheMutex;                                             ///<! mutex to protect replies cache
+   std::map<std::string, std::shared_ptr<THttpCacheEntry>> fCache;     ///<! cached replies of read-only requests
+   std::atomic<Long_t> fCacheLifetime{0};                              ///<! lifetime of cached replies in ms, 0 - no caching
+
+   Bool_t IsCacheable(THttpCallArg *arg) const;
+
+   std::string MakeCacheKey(THttpCallArg *arg) const;
+
+   Bool_t ReplyFromCache(THttpCallArg *arg);
+
+   void StoreInCache(THttpCallArg *arg);
+
    virtual void MissedRequest(THttpCallArg *arg);
 
    virtual void ProcessRequest(std::shared_ptr<THttpCallArg> arg);
@@ -117,6 +131,13 @@ public:
 
    void SetTimer(Long_t milliSec = 100, Bool_t mode = kTRUE);
 
+   void SetCacheLifetime(Long_t milliSec = 1000);
+
+   /** returns lifetime of cached replies in ms, 0 when caching is disabled */
+   Long_t GetCacheLifetime() const { return fCacheLifetime; }
+
+   void ClearCache();
+
    void CreateServerThread();
 
    /** Check if file is requested, thread safe */
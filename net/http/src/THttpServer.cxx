@@ -35,6 +35,7 @@
 #include <string.h>
 #include <fstream>
 #include <chrono>
+#include <mutex>
 
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -59,6 +60,26 @@ public:
    virtual void Timeout() { fServer.ProcessRequests(); }
 };
 
+//////////////////////////////////////////////////////////////////////////
+//                                                                      //
+// THttpCacheEntry                                                      //
+//                                                                      //
+// Reply of a read-only request like root.json, kept by THttpServer     //
+// for a limited time and served directly from the http threads         //
+//                                                                      //
+//////////////////////////////////////////////////////////////////////////
+
+class THttpCacheEntry {
+public:
+   std::chrono::steady_clock::time_point fTime; ///< time when reply was produced
+   TString fContentType;                        ///< content type of the reply
+   TString fHeader;                             ///< reply header
+   Int_t fZipping{THttpCallArg::kNoZip};        ///< zipping mode of the reply
+   std::string fContent;                        ///< reply content
+   std::once_flag fZipOnce;                     ///< gzipped content is produced only once
+   std::string fZipped;                         ///< gzipped content, produced by first client accepting gzip
+};
+
 //////////////////////////////////////////////////////////////////////////////////////////////////
 
 //////////////////////////////////////////////////////////////////////////
@@ -127,6 +148,7 @@ ClassImp(THttpServer);
 ///     cors           - enable CORS header with origin="*"
 ///     cors=domain    - enable CORS header with origin="domain"
 ///     basic_sniffer  - use basic sniffer without support of hist, gpad, graph classes
+///     cache=ms       - cache replies of read-only requests for specified time, see SetCacheLifetime()
 ///
 /// For example, create http server, which allows cors headers and disable scan of global lists,
 /// one should provide "http:8080;cors;noglobal" as parameter
@@ -192,6 +214,8 @@ THttpServer::THttpServer(const char *engine) : TNamed("http", "ROOT http server"
             SetCors(opt + 5);
          } else if (strcmp(opt, "cors") == 0) {
             SetCors("*");
+         } else if (strncmp(opt, "cache=", 6) == 0) {
+            SetCacheLifetime(atol(opt + 6));
          } else
             CreateEngine(opt);
       }
@@ -277,6 +301,7 @@ void THttpServer::SetReadOnly(Bool_t readonly)
 {
    if (fSniffer)
       fSniffer->SetReadOnly(readonly);
+   ClearCache();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -433,6 +458,155 @@ void THttpServer::SetTimer(Long_t milliSec, Bool_t mode)
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Enable caching of replies for read-only requests
+///
+/// Requests like root.json, root.bin, root.xml, h.json or h.xml are processed
+/// once in the main thread, then during milliSec milliseconds all identical
+/// requests (same path, file name, query and user) are replied directly from
+/// the http threads, without waiting for the main thread and without
+/// repeating objects serialization. Gzipped content is also produced only
+/// once and kept together with the cached reply.
+/// Objects shown by the clients can therefore be up to milliSec old.
+/// Value 0 (default) disables caching.
+
+void THttpServer::SetCacheLifetime(Long_t milliSec)
+{
+   fCacheLifetime = (milliSec > 0) ? milliSec : 0;
+   ClearCache();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Remove all cached replies
+/// Should be called when objects were changed and clients must see the changes immediately
+
+void THttpServer::ClearCache()
+{
+   std::lock_guard<std::mutex> grd(fCacheMutex);
+   fCache.clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Returns kTRUE if reply on the request can be cached
+/// Only GET requests for data of registered objects or objects hierarchy are cached
+
+Bool_t THttpServer::IsCacheable(THttpCallArg *arg) const
+{
+   if ((fCacheLifetime.load() <= 0) || !arg->IsMethod("GET") || (arg->GetPostDataLength() > 0))
+      return kFALSE;
+
+   TString filename = arg->fFileName;
+   if (filename.EndsWith(".gz"))
+      filename.Resize(filename.Length() - 3);
+
+   return (filename == "root.json") || (filename == "root.bin") || (filename == "root.xml") ||
+          (filename == "h.json") || (filename == "h.xml");
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Produce key of the cached reply, includes user name while access rights may differ
+
+std::string THttpServer::MakeCacheKey(THttpCallArg *arg) const
+{
+   std::string key = arg->fTopName.Data();
+   key.append("\n");
+   key.append(arg->fUserName.Data());
+   key.append("\n");
+   key.append(arg->fPathName.Data());
+   key.append("\n");
+   key.append(arg->fFileName.Data());
+   key.append("\n");
+   key.append(arg->fQuery.Data());
+   return key;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Reply on the request from the cache, can be called from any thread
+/// Returns kTRUE if valid cached reply was found
+
+Bool_t THttpServer::ReplyFromCache(THttpCallArg *arg)
+{
+   if (!IsCacheable(arg))
+      return kFALSE;
+
+   std::shared_ptr<THttpCacheEntry> entry;
+
+   {
+      std::lock_guard<std::mutex> grd(fCacheMutex);
+      auto iter = fCache.find(MakeCacheKey(arg));
+      if (iter == fCache.end())
+         return kFALSE;
+      auto age = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - iter->second->fTime);
+      if (age.count() > fCacheLifetime.load()) {
+         fCache.erase(iter);
+         return kFALSE;
+      }
+      entry = iter->second;
+   }
+
+   arg->fContentType = entry->fContentType;
+   arg->fHeader = entry->fHeader;
+
+   // same rules as used by the engines, but compressed content is shared by all clients
+   Bool_t dozip = kFALSE;
+   switch (entry->fZipping) {
+   case THttpCallArg::kNoZip: break;
+   case THttpCallArg::kZipLarge:
+      if (entry->fContent.length() < 10000)
+         break;
+   case THttpCallArg::kZip: dozip = arg->GetRequestHeader("Accept-Encoding").Index("gzip", 0, TString::kIgnoreCase) != kNPOS; break;
+   case THttpCallArg::kZipAlways: dozip = kTRUE; break;
+   }
+
+   if (dozip) {
+      std::call_once(entry->fZipOnce, [&entry]() {
+         THttpCallArg zip;
+         zip.SetContent(std::string(entry->fContent));
+         zip.CompressWithGzip();
+         entry->fZipped = std::move(zip.fContent);
+      });
+      arg->fContent = entry->fZipped;
+      arg->SetEncoding("gzip");
+      arg->SetZipping(THttpCallArg::kNoZip);
+   } else {
+      arg->fContent = entry->fContent;
+      arg->SetZipping(entry->fZipping);
+   }
+
+   return kTRUE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Keep reply of processed request in the cache, called from the main thread
+
+void THttpServer::StoreInCache(THttpCallArg *arg)
+{
+   if (!IsCacheable(arg) || arg->Is404() || arg->IsPostponed() || arg->IsFile())
+      return;
+
+   auto entry = std::make_shared<THttpCacheEntry>();
+   entry->fTime = std::chrono::steady_clock::now();
+   entry->fContentType = arg->fContentType;
+   entry->fHeader = arg->fHeader;
+   entry->fZipping = arg->fZipping;
+   entry->fContent = arg->fContent;
+
+   const Long_t lifetime = fCacheLifetime.load();
+
+   std::lock_guard<std::mutex> grd(fCacheMutex);
+
+   // drop expired replies, which were not requested anymore
+   for (auto iter = fCache.begin(); iter != fCache.end();) {
+      auto age = std::chrono::duration_cast<std::chrono::milliseconds>(entry->fTime - iter->second->fTime);
+      if (age.count() > lifetime)
+         iter = fCache.erase(iter);
+      else
+         ++iter;
+   }
+
+   fCache[MakeCacheKey(arg)] = entry;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Creates special thread to process all requests, directed to http server
 ///
@@ -562,12 +736,17 @@ Bool_t THttpServer::IsFileRequested(const char *uri, TString &res) const
 /// Executes http request, specified in THttpCallArg structure
 /// Method can be called from any thread
 /// Actual execution will be done in main ROOT thread, where analysis code is running.
+/// If caching is enabled, read-only requests are replied directly in the calling
+/// thread as long as a valid cached reply exists, see SetCacheLifetime()
 
 Bool_t THttpServer::ExecuteHttp(std::shared_ptr<THttpCallArg> arg)
 {
    if (fTerminated)
       return kFALSE;
 
+   if (ReplyFromCache(arg.get()))
+      return kTRUE;
+
    if ((fMainThrdId != 0) && (fMainThrdId == TThread::SelfId())) {
       // should not happen, but one could process requests directly without any signaling
 
@@ -596,6 +775,9 @@ Bool_t THttpServer::ExecuteHttp(THttpCallArg *arg)
    if (fTerminated)
       return kFALSE;
 
+   if (ReplyFromCache(arg))
+      return kTRUE;
+
    if ((fMainThrdId != 0) && (fMainThrdId == TThread::SelfId())) {
       // should not happen, but one could process requests directly without any signaling
 
@@ -723,6 +905,7 @@ Int_t THttpServer::ProcessRequests()
          cnt++;
          ProcessRequest(arg);
          fSniffer->SetCurrentCallArg(nullptr);
+         StoreInCache(arg.get());
       } catch (...) {
          fSniffer->SetCurrentCallArg(nullptr);
       }
@@ -750,6 +933,7 @@ Int_t THttpServer::ProcessRequests()
          cnt++;
          ProcessRequest(arg);
          fSniffer->SetCurrentCallArg(nullptr);
+         StoreInCache(arg);
       } catch (...) {
          fSniffer->SetCurrentCallArg(nullptr);
       }
@@ -1012,6 +1196,7 @@ void THttpServer::ProcessRequest(THttpCallArg *arg)
 
 Bool_t THttpServer::Register(const char *subfolder, TObject *obj)
 {
+   ClearCache();
    return fSniffer->RegisterObject(subfolder, obj);
 }
 
@@ -1022,6 +1207,7 @@ Bool_t THttpServer::Register(const char *subfolder, TObject *obj)
 
 Bool_t THttpServer::Unregister(TObject *obj)
 {
+   ClearCache();
    return fSniffer->UnregisterObject(obj);
 }
 
@@ -1149,6 +1335,7 @@ Bool_t THttpServer::ExecuteWS(std::shared_ptr<THttpCallArg> &arg, Bool_t externa
 void THttpServer::Restrict(const char *path, const char *options)
 {
    fSniffer->Restrict(path, options);
+   ClearCache();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
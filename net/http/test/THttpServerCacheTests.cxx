@@ -0,0 +1,64 @@
+#include "THttpCallArg.h"
+#include "THttpServer.h"
+#include "TNamed.h"
+
+#include "gtest/gtest.h"
+
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+
+// Request the JSON representation of the registered object and return the reply
+static std::string Request(THttpServer &serv, const char *method = "GET")
+{
+   auto arg = std::make_shared<THttpCallArg>();
+   arg->SetMethod(method);
+   arg->SetPathAndFileName("obj/root.json");
+   if (strcmp(method, "POST") == 0)
+      arg->SetPostData(std::string("{}"));
+   serv.ExecuteHttp(arg);
+   return std::string((const char *)arg->GetContent(), arg->GetContentLength());
+}
+
+static bool Contains(const std::string &reply, const char *title)
+{
+   return reply.find(title) != std::string::npos;
+}
+
+TEST(THttpServer, ReplyCache)
+{
+   THttpServer serv("basic_sniffer");
+   serv.SetCacheLifetime(100000);
+   serv.CreateServerThread();
+
+   // requests are processed by the server thread while the caller waits,
+   // so the object is modified only when no request is running
+   TNamed obj("obj", "first_title");
+   serv.Register("/", &obj);
+
+   EXPECT_TRUE(Contains(Request(serv), "first_title"));
+
+   // cache hit: the change is not seen
+   obj.SetTitle("second_title");
+   EXPECT_TRUE(Contains(Request(serv), "first_title"));
+
+   // POST requests are never served from the cache
+   EXPECT_TRUE(Contains(Request(serv, "POST"), "second_title"));
+
+   // expiry
+   serv.SetCacheLifetime(100);
+   EXPECT_TRUE(Contains(Request(serv), "second_title"));
+   obj.SetTitle("third_title");
+   EXPECT_TRUE(Contains(Request(serv), "second_title"));
+   std::this_thread::sleep_for(std::chrono::milliseconds(300));
+   EXPECT_TRUE(Contains(Request(serv), "third_title"));
+
+   // no caching
+   serv.SetCacheLifetime(0);
+   obj.SetTitle("fourth_title");
+   EXPECT_TRUE(Contains(Request(serv), "fourth_title"));
+
+   serv.Unregister(&obj);
+}
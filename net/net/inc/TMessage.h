@@ -49,6 +49,8 @@ private:
    Bool_t   fEvolution;   //True if support for schema evolution required
 
    static Bool_t fgEvolution;  //True if global support for schema evolution required
+   static Int_t  fgLargeCompress;   //Compression settings for large messages without explicit compression
+   static Int_t  fgLargeMinLength;  //Minimum length of a message to be considered large
 
    // TMessage objects cannot be copied or assigned
    TMessage(const TMessage &);           // not implemented
@@ -60,6 +62,7 @@ private:
 protected:
    TMessage(void *buf, Int_t bufsize);   // only called by T(P)Socket::Recv()
    void SetLength() const;               // only called by T(P)Socket::Send()
+   void SetLargeMessageCompression();    // only called by T(P)Socket::Send()
 
 public:
    TMessage(UInt_t what = kMESS_ANY, Int_t bufsiz = TBuffer::kInitialSize);
@@ -91,6 +94,7 @@ public:
 
    static void   EnableSchemaEvolutionForAll(Bool_t enable = kTRUE);
    static Bool_t UsesSchemaEvolutionForAll();
+   static void   SetCompressionForLargeMessages(Int_t settings = 404, Int_t minlength = 65536);
 
    ClassDef(TMessage,0)  // Message buffer class
 };
@@ -28,6 +28,8 @@
 #include "RZip.h"
 
 Bool_t TMessage::fgEvolution = kFALSE;
+Int_t  TMessage::fgLargeCompress = 0;
+Int_t  TMessage::fgLargeMinLength = 65536;
 
 
 ClassImp(TMessage);
@@ -126,6 +128,33 @@ Bool_t TMessage::UsesSchemaEvolutionForAll()
    return fgEvolution;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Static function setting the compression settings (100 * algorithm + level)
+/// used by the sockets for messages of at least minlength bytes that have no
+/// compression settings of their own (and are sent on a socket without
+/// compression settings). The default, 404, selects LZ4 which compresses
+/// several times faster than ZLIB at a slightly worse ratio, a good match for
+/// bulk transfers of large objects. Use settings = 0 to switch it off again;
+/// by default large messages are not compressed.
+///
+/// Note that the receiving side must support the chosen algorithm.
+
+void TMessage::SetCompressionForLargeMessages(Int_t settings, Int_t minlength)
+{
+   fgLargeCompress = settings < 0 ? 0 : settings;
+   fgLargeMinLength = minlength;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Give a large message without compression settings those specified with
+/// SetCompressionForLargeMessages().
+
+void TMessage::SetLargeMessageCompression()
+{
+   if (fgLargeCompress % 100 > 0 && GetCompressionLevel() == 0 && Length() >= fgLargeMinLength)
+      SetCompressionSettings(fgLargeCompress);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Force writing the TStreamerInfo to the message.
 
@@ -545,6 +545,8 @@ Int_t TSocket::Send(const TMessage &mess)
 
    if (GetCompressionLevel() > 0 && mess.GetCompressionLevel() == 0)
       const_cast<TMessage&>(mess).SetCompressionSettings(fCompress);
+   else
+      const_cast<TMessage&>(mess).SetLargeMessageCompression();
 
    if (mess.GetCompressionLevel() > 0)
       const_cast<TMessage&>(mess).Compress();
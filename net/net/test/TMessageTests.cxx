@@ -0,0 +1,65 @@
+#include "MessageTypes.h"
+#include "TH1.h"
+#include "TMessage.h"
+
+#include <cstring>
+#include <memory>
+#include <utility>
+
+#include "gtest/gtest.h"
+
+// Gives access to the steps done by TSocket::Send() and TSocket::Recv()
+class TTestMessage : public TMessage {
+public:
+   TTestMessage(UInt_t what) : TMessage(what) {}
+   TTestMessage(void *buf, Int_t bufsize) : TMessage(buf, bufsize) {}
+
+   // Prepare the message as TSocket::Send() does on a socket without
+   // compression settings, return what would be sent
+   std::pair<const char *, Int_t> PrepareSend()
+   {
+      SetLength();
+      SetLargeMessageCompression();
+      if (GetCompressionLevel() > 0)
+         Compress();
+      if (CompBuffer())
+         return {CompBuffer(), CompLength()};
+      return {Buffer(), Length()};
+   }
+};
+
+// Send a histogram with nbins bins through a message and read it back
+static void RoundTrip(Int_t nbins, Bool_t expectCompressed)
+{
+   TH1D h("h", "h", nbins, 0., 1.);
+   for (Int_t i = 1; i <= nbins; ++i)
+      h.SetBinContent(i, i % 17);
+
+   TTestMessage out(kMESS_OBJECT);
+   out.WriteObject(&h);
+   auto sent = out.PrepareSend();
+   EXPECT_EQ(expectCompressed, out.CompBuffer() != nullptr);
+   if (expectCompressed)
+      EXPECT_LT(sent.second, out.Length());
+
+   // the received message owns its buffer
+   char *buf = new char[sent.second];
+   memcpy(buf, sent.first, sent.second);
+   TTestMessage in(buf, sent.second);
+   EXPECT_EQ(kMESS_OBJECT, in.What()); // kMESS_ZIP is cleared when uncompressing
+   std::unique_ptr<TH1D> hin((TH1D *)in.ReadObject(in.GetClass()));
+   ASSERT_NE(nullptr, hin);
+   ASSERT_EQ(nbins, hin->GetNbinsX());
+   for (Int_t i = 1; i <= nbins; ++i)
+      EXPECT_EQ(h.GetBinContent(i), hin->GetBinContent(i));
+}
+
+TEST(TMessage, CompressionForLargeMessages)
+{
+   TH1::AddDirectory(kFALSE);
+   TMessage::SetCompressionForLargeMessages(404, 10000);
+   RoundTrip(100, kFALSE);  // about 1 kB
+   RoundTrip(10000, kTRUE); // about 80 kB
+   TMessage::SetCompressionForLargeMessages(0);
+   RoundTrip(10000, kFALSE);
+}
@@ -0,0 +1,151 @@
+#include "RConfig.h"
+#include "TList.h"
+#include "TMonitor.h"
+#include "TSocket.h"
+#include "TSysEvtHandler.h"
+#include "TSystem.h"
+
+#include "gtest/gtest.h"
+
+#ifndef R__WIN32
+
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+// Pair of connected sockets with descriptors above FD_SETSIZE, which could
+// not be monitored with select().
+class TMonitorPoll : public ::testing::Test {
+protected:
+   static const int kHighFd = 1500;
+   int fFd[2] = {-1, -1};
+
+   void SetUp() override
+   {
+      struct rlimit rl;
+      if (getrlimit(RLIMIT_NOFILE, &rl) == 0 && rl.rlim_cur < (rlim_t)kHighFd + 2) {
+         rl.rlim_cur = kHighFd + 2;
+         if (rl.rlim_max != RLIM_INFINITY && rl.rlim_max < rl.rlim_cur)
+            return; // the descriptors cannot be opened, see HasHighFds()
+         setrlimit(RLIMIT_NOFILE, &rl);
+      }
+      int sv[2];
+      if (socketpair(AF_UNIX, SOCK_STREAM, 0, sv) != 0)
+         return;
+      fFd[0] = dup2(sv[0], kHighFd);
+      fFd[1] = dup2(sv[1], kHighFd + 1);
+      close(sv[0]);
+      close(sv[1]);
+   }
+
+   void TearDown() override
+   {
+      for (int fd : fFd)
+         if (fd >= 0)
+            close(fd);
+   }
+
+   bool HasHighFds() const { return fFd[0] == kHighFd && fFd[1] == kHighFd + 1; }
+};
+
+class TCountingHandler : public TFileHandler {
+public:
+   int fNRead = 0;
+   int fNWrite = 0;
+
+   TCountingHandler(int fd, int mask) : TFileHandler(fd, mask) {}
+   Bool_t ReadNotify() override { ++fNRead; return kTRUE; }
+   Bool_t WriteNotify() override { ++fNWrite; return kTRUE; }
+};
+
+TEST_F(TMonitorPoll, DispatchOneEvent)
+{
+   ASSERT_TRUE(HasHighFds());
+
+   TCountingHandler rd(fFd[0], TFileHandler::kRead);
+   TCountingHandler wr(fFd[1], TFileHandler::kWrite);
+   rd.Add();
+   wr.Add();
+
+   // nothing to read yet, the other end is writable
+   for (int i = 0; i < 10 && !wr.fNWrite; ++i)
+      gSystem->DispatchOneEvent(kTRUE);
+   EXPECT_LT(0, wr.fNWrite);
+   EXPECT_EQ(0, rd.fNRead);
+
+   ASSERT_EQ(1, write(fFd[1], "x", 1));
+   for (int i = 0; i < 10 && !rd.fNRead; ++i)
+      gSystem->DispatchOneEvent(kTRUE);
+   EXPECT_LT(0, rd.fNRead);
+
+   rd.Remove();
+   wr.Remove();
+}
+
+TEST_F(TMonitorPoll, Select)
+{
+   ASSERT_TRUE(HasHighFds());
+
+   // the sockets take over the descriptors
+   TSocket *s0 = new TSocket(fFd[0], "pair0");
+   TSocket *s1 = new TSocket(fFd[1], "pair1");
+   fFd[0] = fFd[1] = -1;
+
+   {
+      // handlers in the main event loop
+      TMonitor mon;
+      mon.Add(s1, TMonitor::kWrite);
+      EXPECT_EQ(s1, mon.Select(1000));
+      mon.RemoveAll();
+
+      ASSERT_EQ(1, s1->SendRaw("x", 1));
+      mon.Add(s0, TMonitor::kRead);
+      EXPECT_EQ(s0, mon.Select(1000));
+      char c = 0;
+      ASSERT_EQ(1, s0->RecvRaw(&c, 1));
+      EXPECT_EQ('x', c);
+   }
+
+   {
+      // handlers polled by TSystem::Select(TList*, Long_t)
+      TMonitor mon(kFALSE);
+      mon.Add(s0, TMonitor::kRead);
+      mon.Add(s1, TMonitor::kWrite);
+      TList rdready, wrready;
+      EXPECT_EQ(1, mon.Select(&rdready, &wrready, 1000));
+      EXPECT_EQ(0, rdready.GetSize());
+      ASSERT_EQ(1, wrready.GetSize());
+      EXPECT_EQ(s1, wrready.First());
+
+      ASSERT_EQ(1, s1->SendRaw("x", 1));
+      EXPECT_EQ(2, mon.Select(&rdready, &wrready, 1000));
+      ASSERT_EQ(1, rdready.GetSize());
+      EXPECT_EQ(s0, rdready.First());
+      ASSERT_EQ(1, wrready.GetSize());
+      EXPECT_EQ(s1, wrready.First());
+   }
+
+   delete s0;
+   delete s1;
+}
+
+TEST_F(TMonitorPoll, BadDescriptor)
+{
+   ASSERT_TRUE(HasHighFds());
+
+   TFileHandler rd(fFd[0], TFileHandler::kRead);
+   TFileHandler wr(fFd[1], TFileHandler::kWrite);
+   TList active;
+   active.Add(&rd);
+   active.Add(&wr);
+   EXPECT_EQ(1, gSystem->Select(&active, 0));
+   EXPECT_TRUE(wr.IsWriteReady());
+
+   // like select(), an invalid descriptor makes the whole call fail with EBADF
+   close(fFd[0]);
+   fFd[0] = -1;
+   EXPECT_EQ(-3, gSystem->Select(&active, 0));
+   EXPECT_EQ(-3, gSystem->Select(&rd, 0));
+}
+
+#endif
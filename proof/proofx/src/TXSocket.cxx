@@ -1705,6 +1705,8 @@ Int_t TXSocket::Send(const TMessage &mess)
 
    if (GetCompressionLevel() > 0 && mess.GetCompressionLevel() == 0)
       const_cast<TMessage&>(mess).SetCompressionSettings(fCompress);
+   else
+      const_cast<TMessage&>(mess).SetLargeMessageCompression();
 
    if (mess.GetCompressionLevel() > 0)
       const_cast<TMessage&>(mess).Compress();
@@ -130,6 +130,7 @@ protected:
    UInt_t         fNEntriesSinceSorting;  ///<! Number of entries processed since the last re-sorting of branches
    std::vector<std::pair<Long64_t,TBranch*>> fSortedBranches; ///<! Branches to be processed in parallel when IMT is on, sorted by average task time
    std::vector<TBranch*> fSeqBranches;    ///<! Branches to be processed sequentially when IMT is on
+   Int_t          fReadAccess{0};         ///<! Read access pattern (EReadAccess) targeted by AdaptBasketSizes
    Float_t fTargetMemoryRatio{1.1f};      ///<! Ratio for memory usage in uncompressed buffers versus actual occupancy.  1.0
                                            /// indicates basket should be resized to exact memory usage, but causes significant
 /// memory churn.
@@ -151,6 +152,7 @@ private:
    void             SortBranchesByTime();
    Int_t            FlushBasketsImpl() const;
    void             MarkEventCluster();
+   void             AdaptBasketSizes();
 
 protected:
    virtual void     KeepCircular();
@@ -233,9 +235,17 @@ public:
    enum EStatusBits {
       kForceRead = BIT(11),
       kCircular = BIT(12),
-      kOnlyFlushAtCluster = BIT(14) // If set, the branch's buffers will grow until an event cluster boundary is hit,
+      kOnlyFlushAtCluster = BIT(14), // If set, the branch's buffers will grow until an event cluster boundary is hit,
       // guaranteeing a basket per cluster.  This mode does not provide any guarantee on the
       // memory bounds in the case of extremely large events.
+      kAdaptiveBaskets = BIT(20) // If set, the branch buffer sizes are re-tuned at every automatic flush
+      // so that each branch keeps writing about one basket per cluster (see AdaptBasketSizes).
+   };
+
+   // Read access pattern targeted by the adaptive basket sizing (see SetReadAccessPattern)
+   enum EReadAccess {
+      kSequentialRead = 0, // All the entries of a cluster are read: one basket per branch and cluster.
+      kSparseRead = 1      // Few entries of a cluster are read: several smaller baskets per branch and cluster.
    };
 
    // Split level modifier
@@ -445,6 +455,7 @@ public:
    TVirtualTreePlayer     *GetPlayer();
    virtual Int_t           GetPacketSize() const { return fPacketSize; }
    virtual TVirtualPerfStats *GetPerfStats() const { return fPerfStats; }
+   EReadAccess             GetReadAccessPattern() const { return static_cast<EReadAccess>(fReadAccess); }
    virtual Long64_t        GetReadEntry()  const { return fReadEntry; }
    virtual Long64_t        GetReadEvent()  const { return fReadEntry; }
    virtual Int_t           GetScanField()  const { return fScanField; }
@@ -584,6 +595,7 @@ public:
    virtual void            SetObject(const char* name, const char* title);
    virtual void            SetParallelUnzip(Bool_t opt=kTRUE, Float_t RelSize=-1);
    virtual void            SetPerfStats(TVirtualPerfStats* perf);
+   void                    SetReadAccessPattern(EReadAccess access);
    virtual void            SetScanField(Int_t n = 50) { fScanField = n; } // *MENU*
    void SetTargetMemoryRatio(Float_t ratio) { fTargetMemoryRatio = ratio; }
    virtual void            SetTimerInterval(Int_t msec = 333) { fTimerInterval=msec; }
@@ -27,13 +27,46 @@
 #include "ROOT/TIOFeatures.hxx"
 #include "RZip.h"
 
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#endif
+
 #include <bitset>
+#include <memory>
+#include <vector>
 
 const UInt_t kDisplacementMask = 0xFF000000;  // In the streamer the two highest bytes of
                                               // the fEntryOffset are used to stored displacement.
 
 ClassImp(TBasket);
 
+#ifdef R__USE_IMT
+////////////////////////////////////////////////////////////////////////////////
+/// Compress the `nbuffers` blocks (of at most kMAXZIPBUF bytes each) of `objbuf`
+/// concurrently, each into its own scratch buffer.  Every block carries its own
+/// header on file, so the result is byte-identical to compressing the blocks one
+/// after the other into the same output buffer.  A block that could not be
+/// compressed is reported with a size of 0.
+
+static void ZipBlocksParallel(Int_t cxlevel, ROOT::ECompressionAlgorithm cxAlgorithm, char *objbuf, Int_t objlen,
+                              Int_t nbuffers, std::vector<std::unique_ptr<char[]>> &blocks,
+                              std::vector<Int_t> &sizes)
+{
+   blocks.resize(nbuffers);
+   sizes.assign(nbuffers, 0);
+   auto zipBlock = [&](unsigned int i) {
+      Int_t bufmax = (i == (unsigned int)nbuffers - 1) ? objlen - i * kMAXZIPBUF : kMAXZIPBUF;
+      blocks[i].reset(new char[bufmax]);
+      Int_t nout = 0;
+      R__zipMultipleAlgorithm(cxlevel, &bufmax, objbuf + (Long64_t)i * kMAXZIPBUF, &bufmax, blocks[i].get(), &nout,
+                              cxAlgorithm);
+      sizes[i] = nout;
+   };
+   ROOT::TThreadExecutor pool;
+   pool.Foreach(zipBlock, ROOT::TSeq<unsigned int>(nbuffers));
+}
+#endif // R__USE_IMT
+
 /** \class TBasket
 \ingroup tree
 
@@ -1127,22 +1160,38 @@ Int_t TBasket::WriteBuffer()
       char *bufcur = &fBuffer[fKeylen];
       noutot = 0;
       nzip   = 0;
+      // Baskets spanning several compression blocks have their blocks compressed
+      // concurrently when IMT is on; the loop below then only copies them in place.
+      std::vector<std::unique_ptr<char[]>> zipBlocks;
+      std::vector<Int_t> zipSizes;
+#ifdef R__USE_IMT
+      if (nbuffers > 1 && ROOT::IsImplicitMTEnabled()) {
+         sentry.unlock();
+         ZipBlocksParallel(cxlevel, cxAlgorithm, objbuf, fObjlen, nbuffers, zipBlocks, zipSizes);
+         sentry.lock();
+      }
+#endif  // R__USE_IMT
       for (Int_t i = 0; i < nbuffers; ++i) {
          if (i == nbuffers - 1) bufmax = fObjlen - nzip;
          else bufmax = kMAXZIPBUF;
-         // Compress the buffer.  Note that we allow multiple TBasket compressions to occur at once
-         // for a given TFile: that's because the compression buffer when we use IMT is no longer
-         // shared amongst several threads.
+         if (!zipBlocks.empty()) {
+            nout = zipSizes[i];
+            if (nout) memcpy(bufcur, zipBlocks[i].get(), nout);
+         } else {
+            // Compress the buffer.  Note that we allow multiple TBasket compressions to occur at once
+            // for a given TFile: that's because the compression buffer when we use IMT is no longer
+            // shared amongst several threads.
 #ifdef R__USE_IMT
-         sentry.unlock();
+            sentry.unlock();
 #endif  // R__USE_IMT
-         // NOTE this is declared with C linkage, so it shouldn't except.  Also, when
-         // USE_IMT is defined, we are guaranteed that the compression buffer is unique per-branch.
-         // (see fCompressedBufferRef in constructor).
-         R__zipMultipleAlgorithm(cxlevel, &bufmax, objbuf, &bufmax, bufcur, &nout, cxAlgorithm);
+            // NOTE this is declared with C linkage, so it shouldn't except.  Also, when
+            // USE_IMT is defined, we are guaranteed that the compression buffer is unique per-branch.
+            // (see fCompressedBufferRef in constructor).
+            R__zipMultipleAlgorithm(cxlevel, &bufmax, objbuf, &bufmax, bufcur, &nout, cxAlgorithm);
 #ifdef R__USE_IMT
-         sentry.lock();
+            sentry.lock();
 #endif  // R__USE_IMT
+         }
 
          // test if buffer has really been compressed. In case of small buffers
          // when the buffer contains random data, it may happen that the compressed
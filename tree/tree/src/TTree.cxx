@@ -862,6 +862,11 @@ TTree::TTree(const char* name, const char* title, Int_t splitlevel /* = 99 */,
    // FIXME: This is very annoying behaviour, we should
    //        be able to choose to not do this like we
    //        can with a histogram.
+   // A memory resident tree is not attached to gROOT by the threads that
+   // opted out (see TDirectory::AddDirectoryThisThread); a tree created in
+   // a file is always attached to it, its baskets are written there.
+   if (fDirectory == gROOT && !TDirectory::AddDirectoryThisThreadStatus())
+      fDirectory = nullptr;
    if (fDirectory) fDirectory->Append(this);
 
    fBranches.SetOwner(kTRUE);
@@ -4541,6 +4546,8 @@ Int_t TTree::Fill()
          Info("TTree::Fill", "FlushBaskets() called at entry %lld, fZipBytes=%lld, fFlushedBytes=%lld\n", fEntries,
               GetZipBytes(), fFlushedBytes);
       fFlushedBytes = GetZipBytes();
+      if (TestBit(kAdaptiveBaskets) && !TestBit(kOnlyFlushAtCluster))
+         AdaptBasketSizes();
    }
 
    if (autoSave) {
@@ -6875,6 +6882,64 @@ void TTree::OptimizeBaskets(ULong64_t maxMemory, Float_t minComp, Option_t *opti
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Re-tune the buffer size of every branch so that the entries of one cluster
+/// (fAutoFlush entries) fit in a single basket, or in a few smaller baskets if
+/// the tree is meant to be read sparsely (see SetReadAccessPattern).
+///
+/// Called by TTree::Fill after each automatic flush when the kAdaptiveBaskets
+/// bit is set.  Whereas OptimizeBaskets runs once, at the first flush, this
+/// follows the average entry size of each branch for the whole write: a branch
+/// whose entries grow gets larger baskets instead of many small ones (and as
+/// many seeks when reading it alone), a branch whose entries shrink releases
+/// the memory it no longer needs.  A buffer size is only changed when it is off
+/// by more than 25%, so that buffers are not reallocated at every cluster.
+
+void TTree::AdaptBasketSizes()
+{
+   if (fAutoFlush <= 0) return;
+
+   const Long64_t bmin = 512;
+   const Long64_t hardmax = 1*1024*1024*1024; // Same bound as in OptimizeBaskets.
+   // For sparse reads a cluster is split in kSparseBaskets baskets, so that reading
+   // a single entry decompresses less data, but a basket is kept above
+   // kSparseBasketMin bytes to bound the number of seeks and of basket headers.
+   const Long64_t kSparseBaskets = 8;
+   const Long64_t kSparseBasketMin = 8*1024;
+   const Bool_t sparse = (fReadAccess == kSparseRead);
+
+   TObjArray *leaves = GetListOfLeaves();
+   Int_t nleaves = leaves->GetEntriesFast();
+   TBranch *previous = nullptr;
+   for (Int_t i = 0; i < nleaves; ++i) {
+      TBranch *branch = static_cast<TLeaf*>(leaves->UncheckedAt(i))->GetBranch();
+      if (branch == previous) continue; // several leaves of the same branch
+      previous = branch;
+      if (branch->GetListOfBranches()->GetEntriesFast() > 0 || branch->GetEntries() == 0) continue;
+
+      Double_t perEntry = Double_t(branch->GetTotBytes()) / branch->GetEntries();
+      auto basketSize = [&](Long64_t nentries) {
+         Double_t target = perEntry * nentries * 1.05;
+         if (branch->GetEntryOffsetLen()) target += nentries * sizeof(Int_t) * 2;
+         Long64_t bsize = Long64_t(target);
+         return bsize - bsize%512 + 512;
+      };
+      Long64_t newBsize = basketSize(fAutoFlush);
+      if (sparse)
+         newBsize = TMath::Min(newBsize, TMath::Max(basketSize(TMath::Max(fAutoFlush / kSparseBaskets, 1LL)), kSparseBasketMin));
+      if (newBsize < bmin) newBsize = bmin;
+      if (newBsize > hardmax) newBsize = hardmax;
+
+      Int_t oldBsize = branch->GetBasketSize();
+      if (newBsize > 1.25 * oldBsize || newBsize < 0.75 * oldBsize) {
+         if (gDebug > 0)
+            Info("AdaptBasketSizes", "Changing buffer size from %6d to %6lld bytes for %s at entry %lld", oldBsize,
+                 newBsize, branch->GetName(), fEntries);
+         branch->SetBasketSize(Int_t(newBsize));
+      }
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Interface to the Principal Components Analysis class.
 ///
@@ -7824,6 +7889,12 @@ Bool_t TTree::SetAlias(const char* aliasName, const char* aliasFormula)
 /// Flushing the buffers at regular intervals optimize the location of
 /// consecutive entries on the disk by creating clusters of baskets.
 ///
+/// The branch buffer sizes are computed once, at the first flush (see
+/// OptimizeBaskets).  When the entry sizes of the branches change during the
+/// write, `tree->SetBit(TTree::kAdaptiveBaskets)` keeps them tuned at every
+/// later flush (see AdaptBasketSizes), for the read access pattern given with
+/// SetReadAccessPattern.
+///
 /// A cluster of baskets is a set of baskets that contains all
 /// the data for a (consecutive) set of entries and that is stored
 /// consecutively on the disk.   When reading all the branches, this
@@ -8857,6 +8928,24 @@ void TTree::SetPerfStats(TVirtualPerfStats *perf)
    fPerfStats = perf;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Set the read access pattern the branch buffer sizes are tuned for, and
+/// enable the tuning at every automatic flush (kAdaptiveBaskets).
+///
+///  - kSequentialRead (default): the entries are read in sequence, all the
+///    entries of a cluster are needed.  Each branch writes about one basket per
+///    cluster, which minimizes the number of seeks and of basket headers.
+///  - kSparseRead: only few entries of each cluster are read (e.g. after a
+///    selection, or with TTree::GetEntry on random entries).  Each branch writes
+///    several smaller baskets per cluster, so that reading one entry decompresses
+///    less data; the baskets are kept above a few kB to bound the number of seeks.
+
+void TTree::SetReadAccessPattern(EReadAccess access)
+{
+   fReadAccess = access;
+   SetBit(kAdaptiveBaskets);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// The current TreeIndex is replaced by the new index.
 /// Note that this function does not delete the previous index.
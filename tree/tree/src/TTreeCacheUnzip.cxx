@@ -820,8 +820,7 @@ Int_t TTreeCacheUnzip::GetUnzipBuffer(char **buf, Long64_t pos, Int_t len, Bool_
       {
          // Fill new baskets into cache.
          R__LOCKGUARD(fIOMutex);
-	 fFile->Seek(pos);
-	 res = fFile->ReadBuffer(fCompBuffer, len);
+	 res = fFile->ReadBuffer(fCompBuffer, pos, len);
       } // end of lock scope
 #ifdef R__USE_IMT
       CreateTasks();
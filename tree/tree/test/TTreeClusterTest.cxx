@@ -1,4 +1,5 @@
 #include "TFile.h"
+#include "TMemFile.h"
 #include "TTree.h"
 #include "TBranch.h"
 #include "TRandom.h"
@@ -53,3 +54,44 @@ TEST_F(TTreeClusterTest, countBaskets)
 
    delete file;
 }
+
+TEST(TTreeClusterTest, adaptiveBaskets)
+{
+   TMemFile file("TTreeClusterAdaptive.root", "RECREATE");
+   TTree tree("tree", "A test tree with fixed basket sizes");
+   TTree tree2("tree2", "A test tree with adaptive basket sizes");
+   TTree tree3("tree3", "A test tree with adaptive basket sizes for sparse reads");
+   tree2.SetBit(TTree::kAdaptiveBaskets);
+   tree3.SetReadAccessPattern(TTree::kSparseRead);
+   EXPECT_TRUE(tree3.TestBit(TTree::kAdaptiveBaskets));
+   Int_t n = 1;
+   Double_t arr[64] = {0};
+   for (TTree *t : {&tree, &tree2, &tree3}) {
+      t->SetAutoFlush(500);
+      t->Branch("n", &n, "n/I");
+      t->Branch("arr", arr, "arr[n]/D");
+   }
+
+   for (Int_t ev = 0; ev < 5000; ev++) {
+      // The entries become 60 times larger once the basket sizes have been
+      // optimized at the first flush.
+      n = (ev < 1000) ? 1 : 60;
+      for (Int_t i = 0; i < n; ++i)
+         arr[i] = ev + i;
+      tree.Fill();
+      tree2.Fill();
+      tree3.Fill();
+   }
+   tree.FlushBaskets();
+   tree2.FlushBaskets();
+   tree3.FlushBaskets();
+
+   auto branch = tree.GetBranch("arr");
+   auto branch2 = tree2.GetBranch("arr");
+   auto branch3 = tree3.GetBranch("arr");
+   EXPECT_GT(branch2->GetBasketSize(), branch->GetBasketSize());
+   EXPECT_LT(4 * branch2->GetWriteBasket(), branch->GetWriteBasket());
+   // about 8 baskets per cluster instead of one
+   EXPECT_LT(branch3->GetBasketSize(), branch2->GetBasketSize() / 4);
+   EXPECT_GT(branch3->GetWriteBasket(), 4 * branch2->GetWriteBasket());
+}